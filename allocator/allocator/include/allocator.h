@@ -37,8 +37,45 @@ public:
         size_t value_size,
         size_t values_count) = 0;
     
+    [[nodiscard]] virtual void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment);
+    
     virtual void deallocate(
         void *at) = 0;
+
+public:
+    
+    virtual void allocate_batch(
+        size_t block_size,
+        size_t blocks_count,
+        void **blocks);
+    
+    virtual void deallocate_batch(
+        void **blocks,
+        size_t blocks_count);
+
+public:
+    
+    [[nodiscard]] virtual void *reallocate(
+        void *at,
+        size_t value_size,
+        size_t old_values_count,
+        size_t new_values_count);
+    
+    virtual bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count);
+
+protected:
+    
+    static inline bool is_valid_alignment(
+        size_t alignment) noexcept;
+    
+    static constexpr size_t round_up_to_max_alignment(
+        size_t size) noexcept;
     
 };
 
@@ -52,6 +89,18 @@ inline void allocator::construct(
     new (at) T(std::forward<Args>(constructor_arguments)...);
 }
 
+inline bool allocator::is_valid_alignment(
+    size_t alignment) noexcept
+{
+    return alignment != 0 && (alignment & (alignment - 1)) == 0;
+}
+
+constexpr size_t allocator::round_up_to_max_alignment(
+    size_t size) noexcept
+{
+    return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
 template<
     typename T>
 inline void allocator::destruct(
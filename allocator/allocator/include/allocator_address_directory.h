@@ -0,0 +1,37 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ADDRESS_DIRECTORY_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ADDRESS_DIRECTORY_H
+
+#include "allocator_guardant.h"
+
+// sorted array of region start addresses kept in an allocator's trusted memory, so the region owning a pointer is found by binary search
+class allocator_address_directory final
+{
+
+public:
+    
+    static void insert(
+        void **&addresses,
+        size_t &addresses_count,
+        size_t &addresses_capacity,
+        void *address,
+        allocator_guardant const &guardant);
+    
+    static void remove(
+        void **addresses,
+        size_t &addresses_count,
+        void *address) noexcept;
+    
+    static void *find_preceding(
+        void **addresses,
+        size_t addresses_count,
+        void const *at) noexcept;
+    
+    static void release(
+        void **&addresses,
+        size_t &addresses_count,
+        size_t &addresses_capacity,
+        allocator_guardant const &guardant);
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ADDRESS_DIRECTORY_H
@@ -0,0 +1,148 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_DEBUG_MODE_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_DEBUG_MODE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+class allocator_debug_mode final
+{
+
+public:
+    
+    static constexpr bool is_enabled() noexcept;
+    
+    static constexpr size_t canary_size() noexcept;
+    
+    static constexpr size_t poison_check_size() noexcept;
+    
+    static inline void set_canary(
+        void *block_end) noexcept;
+    
+    static inline bool is_canary_intact(
+        void const *block_end) noexcept;
+    
+    static inline void poison(
+        void *at,
+        size_t size) noexcept;
+    
+    static inline void clear_poison(
+        void *at,
+        size_t size) noexcept;
+    
+    static inline bool is_poisoned(
+        void const *at,
+        size_t size) noexcept;
+
+private:
+    
+    static constexpr uint64_t canary_value() noexcept;
+    
+    static constexpr unsigned char poison_byte() noexcept;
+    
+};
+
+constexpr bool allocator_debug_mode::is_enabled() noexcept
+{
+#ifdef MP_OS_ALLOCATOR_DEBUG
+    return true;
+#else
+    return false;
+#endif
+}
+
+constexpr size_t allocator_debug_mode::canary_size() noexcept
+{
+    return is_enabled()
+        ? sizeof(uint64_t)
+        : 0;
+}
+
+constexpr size_t allocator_debug_mode::poison_check_size() noexcept
+{
+    return 64;
+}
+
+constexpr uint64_t allocator_debug_mode::canary_value() noexcept
+{
+    return 0x5AFEC0DE5AFEC0DEULL;
+}
+
+constexpr unsigned char allocator_debug_mode::poison_byte() noexcept
+{
+    return 0xDD;
+}
+
+inline void allocator_debug_mode::set_canary(
+    void *block_end) noexcept
+{
+    if (!is_enabled())
+    {
+        return;
+    }
+    
+    uint64_t const canary = canary_value();
+    std::memcpy(reinterpret_cast<unsigned char *>(block_end) - canary_size(), &canary, sizeof(canary));
+}
+
+inline bool allocator_debug_mode::is_canary_intact(
+    void const *block_end) noexcept
+{
+    if (!is_enabled())
+    {
+        return true;
+    }
+    
+    uint64_t canary;
+    std::memcpy(&canary, reinterpret_cast<unsigned char const *>(block_end) - canary_size(), sizeof(canary));
+    
+    return canary == canary_value();
+}
+
+inline void allocator_debug_mode::poison(
+    void *at,
+    size_t size) noexcept
+{
+    if (!is_enabled())
+    {
+        return;
+    }
+    
+    std::memset(at, poison_byte(), size);
+}
+
+inline void allocator_debug_mode::clear_poison(
+    void *at,
+    size_t size) noexcept
+{
+    if (!is_enabled())
+    {
+        return;
+    }
+    
+    std::memset(at, 0, size);
+}
+
+inline bool allocator_debug_mode::is_poisoned(
+    void const *at,
+    size_t size) noexcept
+{
+    if (!is_enabled())
+    {
+        return true;
+    }
+    
+    auto const *bytes = reinterpret_cast<unsigned char const *>(at);
+    
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (bytes[i] != poison_byte())
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_DEBUG_MODE_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_GROWTH_POLICY_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_GROWTH_POLICY_H
+
+#include <cstddef>
+
+class allocator_growth_policy final
+{
+
+private:
+    
+    size_t _segment_size;
+    
+    size_t _max_segments_count;
+    
+    bool _is_releasing_empty_segments;
+
+public:
+    
+    explicit allocator_growth_policy(
+        size_t segment_size = 0,
+        size_t max_segments_count = 1,
+        bool release_empty_segments = true) noexcept;
+
+public:
+    
+    bool can_grow(
+        size_t segments_count) const noexcept;
+    
+    size_t obtain_segment_size(
+        size_t initial_space_size,
+        size_t required_space_size) const noexcept;
+    
+    bool is_releasing_empty_segments() const noexcept;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_GROWTH_POLICY_H
\ No newline at end of file
@@ -32,6 +32,8 @@ public:
     
     virtual std::vector<block_info> get_blocks_info() const noexcept = 0;
     
+    virtual std::vector<std::vector<block_info>> get_segments_blocks_info() const noexcept;
+    
 };
 
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_TEST_UTILS_H
\ No newline at end of file
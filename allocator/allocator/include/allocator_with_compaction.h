@@ -0,0 +1,103 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_WITH_COMPACTION_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_WITH_COMPACTION_H
+
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+class allocator_with_compaction
+{
+
+public:
+    
+    using handle_t = size_t;
+    
+    static constexpr handle_t invalid_handle = 0;
+    
+    class handles_table final
+    {
+    
+    private:
+        
+        struct entry final
+        {
+            
+            void *block;
+            
+            size_t locks_count;
+            
+        };
+    
+    private:
+        
+        std::vector<entry> _entries;
+        
+        std::vector<handle_t> _released_handles;
+        
+        std::unordered_map<void *, handle_t> _handles_by_block;
+    
+    public:
+        
+        handle_t insert(
+            void *block);
+        
+        void *erase(
+            handle_t handle);
+        
+        void *lock(
+            handle_t handle);
+        
+        void unlock(
+            handle_t handle);
+        
+        bool is_valid(
+            handle_t handle) const noexcept;
+        
+        bool is_locked(
+            handle_t handle) const noexcept;
+        
+        bool contains(
+            void *block) const noexcept;
+        
+        bool is_movable(
+            void *block) const noexcept;
+        
+        void relocate(
+            void *block,
+            void *new_block);
+        
+        size_t size() const noexcept;
+    
+    private:
+        
+        entry &obtain_entry(
+            handle_t handle);
+        
+    };
+
+public:
+    
+    virtual ~allocator_with_compaction() noexcept = default;
+
+public:
+    
+    [[nodiscard]] virtual handle_t allocate_relocatable(
+        size_t value_size,
+        size_t values_count) = 0;
+    
+    virtual void deallocate_relocatable(
+        handle_t handle) = 0;
+    
+    [[nodiscard]] virtual void *lock(
+        handle_t handle) = 0;
+    
+    virtual void unlock(
+        handle_t handle) = 0;
+    
+    virtual size_t compact(
+        size_t max_relocations_count = std::numeric_limits<size_t>::max()) = 0;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_WITH_COMPACTION_H
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_WITH_STATISTICS_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_WITH_STATISTICS_H
+
+#include <chrono>
+#include <cstddef>
+
+class allocator_with_statistics
+{
+
+public:
+    
+    struct latency_histogram final
+    {
+        
+        static constexpr size_t buckets_count = 32;
+        
+        size_t buckets[buckets_count];
+        
+        void record(
+            std::chrono::steady_clock::duration latency) noexcept;
+        
+        size_t total_count() const noexcept;
+        
+        std::chrono::nanoseconds percentile(
+            double fraction) const noexcept;
+        
+    };
+    
+    struct statistics_counters final
+    {
+        
+        size_t bytes_in_use;
+        
+        size_t free_blocks_count;
+        
+        size_t largest_free_block_size;
+        
+        size_t largest_free_blocks_count;
+        
+        bool is_largest_free_block_size_actual;
+        
+        size_t allocations_count;
+        
+        size_t deallocations_count;
+        
+        latency_histogram allocate_latency;
+        
+        latency_histogram deallocate_latency;
+        
+        size_t latency_sampling_period;
+        
+        size_t operations_since_latency_sample;
+        
+        void reset() noexcept;
+        
+        bool is_latency_sample_due() noexcept;
+        
+        void on_free_block_appeared(
+            size_t block_size) noexcept;
+        
+        void on_free_block_disappeared(
+            size_t block_size) noexcept;
+        
+    };
+    
+    struct statistics final
+    {
+        
+        size_t bytes_in_use;
+        
+        size_t bytes_free;
+        
+        size_t largest_free_block_size;
+        
+        size_t free_blocks_count;
+        
+        double external_fragmentation;
+        
+        size_t allocations_count;
+        
+        size_t deallocations_count;
+        
+        latency_histogram allocate_latency;
+        
+        latency_histogram deallocate_latency;
+        
+    };
+    
+    class latency_recorder final
+    {
+    
+    private:
+        
+        latency_histogram *_histogram;
+        
+        std::chrono::steady_clock::time_point _started_at;
+    
+    public:
+        
+        latency_recorder(
+            statistics_counters &counters,
+            latency_histogram &histogram) noexcept;
+        
+        ~latency_recorder() noexcept;
+        
+        latency_recorder(
+            latency_recorder const &other) = delete;
+        
+        latency_recorder &operator=(
+            latency_recorder const &other) = delete;
+        
+    };
+
+public:
+    
+    virtual ~allocator_with_statistics() noexcept = default;
+
+public:
+    
+    virtual statistics get_statistics() const noexcept = 0;
+    
+    // latency histograms are filled for every period-th operation only, 0 (the default) turns sampling off
+    virtual void set_latency_sampling_period(
+        size_t period) noexcept = 0;
+
+protected:
+    
+    static statistics collect_statistics(
+        statistics_counters const &counters,
+        size_t space_size,
+        size_t largest_free_block_size) noexcept;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_WITH_STATISTICS_H
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_TRUSTED_MEMORY_BACKING_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_TRUSTED_MEMORY_BACKING_H
+
+#include <limits>
+#include "allocator.h"
+
+class trusted_memory_backing final
+{
+
+public:
+    
+    enum class kind
+    {
+        parent_allocator,
+        anonymous_mapping,
+        transparent_huge_pages,
+        huge_pages
+    };
+
+private:
+    
+    kind _kind;
+    
+    size_t _release_threshold;
+
+public:
+    
+    explicit trusted_memory_backing(
+        kind backing_kind = kind::parent_allocator,
+        size_t release_threshold = std::numeric_limits<size_t>::max()) noexcept;
+
+public:
+    
+    bool is_mapped() const noexcept;
+    
+    [[nodiscard]] void *allocate(
+        size_t size,
+        allocator *parent_allocator) const;
+    
+    void deallocate(
+        void *at,
+        size_t size,
+        allocator *parent_allocator) const;
+    
+    void release_free_pages(
+        void *at,
+        size_t size,
+        void *freed_at,
+        size_t freed_size) const noexcept;
+
+private:
+    
+    size_t obtain_mapping_granularity() const noexcept;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_TRUSTED_MEMORY_BACKING_H
\ No newline at end of file
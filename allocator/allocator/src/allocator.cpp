@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "../include/allocator.h"
+
+void *allocator::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    if (!is_valid_alignment(alignment))
+    {
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    void *result = allocate(value_size, values_count);
+
+    if (reinterpret_cast<uintptr_t>(result) % alignment != 0)
+    {
+        deallocate(result);
+
+        throw std::logic_error("requested alignment is not supported by allocator");
+    }
+
+    return result;
+}
+
+void allocator::allocate_batch(
+    size_t block_size,
+    size_t blocks_count,
+    void **blocks)
+{
+    size_t allocated_count = 0;
+
+    try
+    {
+        for (; allocated_count < blocks_count; ++allocated_count)
+        {
+            blocks[allocated_count] = allocate(block_size, 1);
+        }
+    }
+    catch (...)
+    {
+        deallocate_batch(blocks, allocated_count);
+
+        throw;
+    }
+}
+
+void allocator::deallocate_batch(
+    void **blocks,
+    size_t blocks_count)
+{
+    for (size_t i = 0; i < blocks_count; ++i)
+    {
+        deallocate(blocks[i]);
+    }
+}
+
+void *allocator::reallocate(
+    void *at,
+    size_t value_size,
+    size_t old_values_count,
+    size_t new_values_count)
+{
+    if (at == nullptr)
+    {
+        return allocate(value_size, new_values_count);
+    }
+
+    if (try_expand_in_place(at, value_size, new_values_count))
+    {
+        return at;
+    }
+
+    void *relocated = allocate(value_size, new_values_count);
+    std::memcpy(relocated, at, value_size * std::min(old_values_count, new_values_count));
+    deallocate(at);
+
+    return relocated;
+}
+
+bool allocator::try_expand_in_place(
+    void *,
+    size_t,
+    size_t)
+{
+    return false;
+}
\ No newline at end of file
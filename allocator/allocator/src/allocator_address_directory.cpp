@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "../include/allocator_address_directory.h"
+
+void allocator_address_directory::insert(
+    void **&addresses,
+    size_t &addresses_count,
+    size_t &addresses_capacity,
+    void *address,
+    allocator_guardant const &guardant)
+{
+    if (addresses_count == addresses_capacity)
+    {
+        size_t const new_addresses_capacity = std::max<size_t>(addresses_capacity * 2, 16);
+        auto **new_addresses = reinterpret_cast<void **>(guardant.allocate_with_guard(sizeof(void *), new_addresses_capacity));
+
+        if (addresses != nullptr)
+        {
+            std::memcpy(new_addresses, addresses, sizeof(void *) * addresses_count);
+            guardant.deallocate_with_guard(addresses);
+        }
+
+        addresses = new_addresses;
+        addresses_capacity = new_addresses_capacity;
+    }
+
+    void **position = std::upper_bound(addresses, addresses + addresses_count, address, std::less<void *>());
+    std::memmove(position + 1, position, sizeof(void *) * (addresses + addresses_count - position));
+    *position = address;
+    ++addresses_count;
+}
+
+void allocator_address_directory::remove(
+    void **addresses,
+    size_t &addresses_count,
+    void *address) noexcept
+{
+    void **position = std::lower_bound(addresses, addresses + addresses_count, address, std::less<void *>());
+
+    std::memmove(position, position + 1, sizeof(void *) * (addresses + addresses_count - position - 1));
+    --addresses_count;
+}
+
+void *allocator_address_directory::find_preceding(
+    void **addresses,
+    size_t addresses_count,
+    void const *at) noexcept
+{
+    void **position = std::upper_bound(addresses, addresses + addresses_count, at, std::less<void const *>());
+
+    return position == addresses
+        ? nullptr
+        : *(position - 1);
+}
+
+void allocator_address_directory::release(
+    void **&addresses,
+    size_t &addresses_count,
+    size_t &addresses_capacity,
+    allocator_guardant const &guardant)
+{
+    if (addresses != nullptr)
+    {
+        guardant.deallocate_with_guard(addresses);
+    }
+
+    addresses = nullptr;
+    addresses_count = 0;
+    addresses_capacity = 0;
+}
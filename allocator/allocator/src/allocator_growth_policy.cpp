@@ -0,0 +1,34 @@
+#include <algorithm>
+
+#include "../include/allocator_growth_policy.h"
+
+allocator_growth_policy::allocator_growth_policy(
+    size_t segment_size,
+    size_t max_segments_count,
+    bool release_empty_segments) noexcept:
+    _segment_size(segment_size),
+    _max_segments_count(max_segments_count),
+    _is_releasing_empty_segments(release_empty_segments)
+{
+
+}
+
+bool allocator_growth_policy::can_grow(
+    size_t segments_count) const noexcept
+{
+    return segments_count < _max_segments_count;
+}
+
+size_t allocator_growth_policy::obtain_segment_size(
+    size_t initial_space_size,
+    size_t required_space_size) const noexcept
+{
+    return std::max(_segment_size == 0
+        ? initial_space_size
+        : _segment_size, required_space_size);
+}
+
+bool allocator_growth_policy::is_releasing_empty_segments() const noexcept
+{
+    return _is_releasing_empty_segments;
+}
\ No newline at end of file
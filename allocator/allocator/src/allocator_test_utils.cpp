@@ -11,4 +11,9 @@ bool allocator_test_utils::block_info::operator!=(
     allocator_test_utils::block_info const &other) const noexcept
 {
     return !(*this == other);
+}
+
+std::vector<std::vector<allocator_test_utils::block_info>> allocator_test_utils::get_segments_blocks_info() const noexcept
+{
+    return std::vector<std::vector<block_info>> { get_blocks_info() };
 }
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include <stdexcept>
+
+#include "../include/allocator_with_compaction.h"
+
+allocator_with_compaction::handle_t allocator_with_compaction::handles_table::insert(
+    void *block)
+{
+    bool const is_handle_reused = !_released_handles.empty();
+    handle_t const handle = is_handle_reused
+        ? _released_handles.back()
+        : _entries.size() + 1;
+
+    if (!is_handle_reused)
+    {
+        _entries.push_back(entry { nullptr, 0 });
+    }
+
+    try
+    {
+        _handles_by_block.emplace(block, handle);
+    }
+    catch (...)
+    {
+        if (!is_handle_reused)
+        {
+            _entries.pop_back();
+        }
+
+        throw;
+    }
+
+    _entries[handle - 1] = entry { block, 0 };
+
+    if (is_handle_reused)
+    {
+        _released_handles.pop_back();
+    }
+
+    return handle;
+}
+
+void *allocator_with_compaction::handles_table::erase(
+    handle_t handle)
+{
+    entry &target = obtain_entry(handle);
+
+    if (target.locks_count != 0)
+    {
+        throw std::logic_error("attempt to deallocate locked block");
+    }
+
+    _released_handles.reserve(_released_handles.size() + 1);
+
+    void *block = target.block;
+    _handles_by_block.erase(block);
+    target.block = nullptr;
+    _released_handles.push_back(handle);
+
+    return block;
+}
+
+void *allocator_with_compaction::handles_table::lock(
+    handle_t handle)
+{
+    entry &target = obtain_entry(handle);
+    ++target.locks_count;
+
+    return target.block;
+}
+
+void allocator_with_compaction::handles_table::unlock(
+    handle_t handle)
+{
+    entry &target = obtain_entry(handle);
+
+    if (target.locks_count == 0)
+    {
+        throw std::logic_error("attempt to unlock block which is not locked");
+    }
+
+    --target.locks_count;
+}
+
+bool allocator_with_compaction::handles_table::is_valid(
+    handle_t handle) const noexcept
+{
+    return handle != invalid_handle && handle <= _entries.size() && _entries[handle - 1].block != nullptr;
+}
+
+bool allocator_with_compaction::handles_table::is_locked(
+    handle_t handle) const noexcept
+{
+    return is_valid(handle) && _entries[handle - 1].locks_count != 0;
+}
+
+bool allocator_with_compaction::handles_table::contains(
+    void *block) const noexcept
+{
+    return _handles_by_block.find(block) != _handles_by_block.end();
+}
+
+bool allocator_with_compaction::handles_table::is_movable(
+    void *block) const noexcept
+{
+    auto found = _handles_by_block.find(block);
+
+    return found != _handles_by_block.end() && _entries[found->second - 1].locks_count == 0;
+}
+
+void allocator_with_compaction::handles_table::relocate(
+    void *block,
+    void *new_block)
+{
+    auto found = _handles_by_block.find(block);
+    handle_t const handle = found->second;
+
+    _handles_by_block.emplace(new_block, handle);
+    _handles_by_block.erase(block);
+    _entries[handle - 1].block = new_block;
+}
+
+size_t allocator_with_compaction::handles_table::size() const noexcept
+{
+    return _handles_by_block.size();
+}
+
+allocator_with_compaction::handles_table::entry &allocator_with_compaction::handles_table::obtain_entry(
+    handle_t handle)
+{
+    if (!is_valid(handle))
+    {
+        throw std::logic_error("invalid relocatable block handle");
+    }
+
+    return _entries[handle - 1];
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <limits>
+
+#include "../include/allocator_with_statistics.h"
+
+void allocator_with_statistics::latency_histogram::record(
+    std::chrono::steady_clock::duration latency) noexcept
+{
+    auto const nanoseconds = static_cast<unsigned long long>(std::max<std::chrono::nanoseconds::rep>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count(), 1));
+    size_t const bucket = static_cast<size_t>(std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(nanoseconds));
+
+    ++buckets[std::min(bucket, buckets_count - 1)];
+}
+
+size_t allocator_with_statistics::latency_histogram::total_count() const noexcept
+{
+    size_t count = 0;
+
+    for (size_t bucket_count: buckets)
+    {
+        count += bucket_count;
+    }
+
+    return count;
+}
+
+std::chrono::nanoseconds allocator_with_statistics::latency_histogram::percentile(
+    double fraction) const noexcept
+{
+    size_t const threshold = static_cast<size_t>(static_cast<double>(total_count()) * fraction);
+    size_t count = 0;
+
+    for (size_t bucket = 0; bucket < buckets_count; ++bucket)
+    {
+        count += buckets[bucket];
+
+        if (count > threshold)
+        {
+            return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(1) << (bucket + 1));
+        }
+    }
+
+    return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(1) << buckets_count);
+}
+
+void allocator_with_statistics::statistics_counters::reset() noexcept
+{
+    bytes_in_use = 0;
+    free_blocks_count = 0;
+    largest_free_block_size = 0;
+    largest_free_blocks_count = 0;
+    is_largest_free_block_size_actual = true;
+    allocations_count = 0;
+    deallocations_count = 0;
+    std::fill(allocate_latency.buckets, allocate_latency.buckets + latency_histogram::buckets_count, 0);
+    std::fill(deallocate_latency.buckets, deallocate_latency.buckets + latency_histogram::buckets_count, 0);
+    latency_sampling_period = 0;
+    operations_since_latency_sample = 0;
+}
+
+bool allocator_with_statistics::statistics_counters::is_latency_sample_due() noexcept
+{
+    if (latency_sampling_period == 0 || ++operations_since_latency_sample < latency_sampling_period)
+    {
+        return false;
+    }
+
+    operations_since_latency_sample = 0;
+
+    return true;
+}
+
+void allocator_with_statistics::statistics_counters::on_free_block_appeared(
+    size_t block_size) noexcept
+{
+    ++free_blocks_count;
+
+    // while the maximum is stale every remaining free block is smaller than it, so a block of at least that size is the new maximum
+    if (block_size > largest_free_block_size || (block_size == largest_free_block_size && !is_largest_free_block_size_actual))
+    {
+        largest_free_block_size = block_size;
+        largest_free_blocks_count = 1;
+        is_largest_free_block_size_actual = true;
+    }
+    else if (block_size == largest_free_block_size)
+    {
+        ++largest_free_blocks_count;
+    }
+}
+
+void allocator_with_statistics::statistics_counters::on_free_block_disappeared(
+    size_t block_size) noexcept
+{
+    --free_blocks_count;
+
+    if (is_largest_free_block_size_actual && block_size == largest_free_block_size && --largest_free_blocks_count == 0)
+    {
+        is_largest_free_block_size_actual = false;
+    }
+}
+
+allocator_with_statistics::latency_recorder::latency_recorder(
+    statistics_counters &counters,
+    latency_histogram &histogram) noexcept:
+    _histogram(counters.is_latency_sample_due()
+        ? &histogram
+        : nullptr)
+{
+    if (_histogram != nullptr)
+    {
+        _started_at = std::chrono::steady_clock::now();
+    }
+}
+
+allocator_with_statistics::latency_recorder::~latency_recorder() noexcept
+{
+    if (_histogram != nullptr)
+    {
+        _histogram->record(std::chrono::steady_clock::now() - _started_at);
+    }
+}
+
+allocator_with_statistics::statistics allocator_with_statistics::collect_statistics(
+    statistics_counters const &counters,
+    size_t space_size,
+    size_t largest_free_block_size) noexcept
+{
+    statistics result;
+
+    result.bytes_in_use = counters.bytes_in_use;
+    result.bytes_free = space_size - counters.bytes_in_use;
+    result.largest_free_block_size = largest_free_block_size;
+    result.free_blocks_count = counters.free_blocks_count;
+    result.external_fragmentation = result.bytes_free == 0
+        ? 0.0
+        : 1.0 - static_cast<double>(largest_free_block_size) / static_cast<double>(result.bytes_free);
+    result.allocations_count = counters.allocations_count;
+    result.deallocations_count = counters.deallocations_count;
+    result.allocate_latency = counters.allocate_latency;
+    result.deallocate_latency = counters.deallocate_latency;
+
+    return result;
+}
\ No newline at end of file
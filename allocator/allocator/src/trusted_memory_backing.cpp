@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../include/trusted_memory_backing.h"
+
+trusted_memory_backing::trusted_memory_backing(
+    kind backing_kind,
+    size_t release_threshold) noexcept:
+    _kind(backing_kind),
+    _release_threshold(release_threshold)
+{
+
+}
+
+bool trusted_memory_backing::is_mapped() const noexcept
+{
+    return _kind != kind::parent_allocator;
+}
+
+void *trusted_memory_backing::allocate(
+    size_t size,
+    allocator *parent_allocator) const
+{
+    if (!is_mapped())
+    {
+        return parent_allocator == nullptr
+            ? ::operator new(size)
+            : parent_allocator->allocate(1, size);
+    }
+
+    size_t const granularity = obtain_mapping_granularity();
+    size_t const mapping_size = (size + granularity - 1) / granularity * granularity;
+    void *mapping = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    if (_kind == kind::huge_pages)
+    {
+        mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+
+    if (mapping == MAP_FAILED)
+    {
+        mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+#ifdef MADV_HUGEPAGE
+        if (_kind != kind::anonymous_mapping)
+        {
+            madvise(mapping, mapping_size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    return mapping;
+}
+
+void trusted_memory_backing::deallocate(
+    void *at,
+    size_t size,
+    allocator *parent_allocator) const
+{
+    if (!is_mapped())
+    {
+        parent_allocator == nullptr
+            ? ::operator delete(at)
+            : parent_allocator->deallocate(at);
+
+        return;
+    }
+
+    size_t const granularity = obtain_mapping_granularity();
+    munmap(at, (size + granularity - 1) / granularity * granularity);
+}
+
+void trusted_memory_backing::release_free_pages(
+    void *at,
+    size_t size,
+    void *freed_at,
+    size_t freed_size) const noexcept
+{
+    if (!is_mapped() || size < _release_threshold)
+    {
+        return;
+    }
+
+    static size_t const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t const granularity = _kind == kind::huge_pages
+        ? obtain_mapping_granularity()
+        : page_size;
+
+    auto const block_begin = reinterpret_cast<uintptr_t>(at);
+    auto const block_end = block_begin + size;
+    auto const freed_begin = reinterpret_cast<uintptr_t>(freed_at);
+    auto const freed_end = freed_begin + freed_size;
+
+    // a coalesced neighbour of at least the threshold had its pages released when it was freed itself, while a smaller one
+    // kept them until now, when the block it joined reached the threshold
+    auto const released_begin = freed_begin > block_begin && freed_begin - block_begin >= _release_threshold
+        ? freed_begin
+        : block_begin;
+    auto const released_end = block_end > freed_end && block_end - freed_end >= _release_threshold
+        ? freed_end
+        : block_end;
+
+    auto const begin = std::max(
+        (block_begin + granularity - 1) / granularity * granularity,
+        released_begin / granularity * granularity);
+    auto const end = std::min(
+        block_end / granularity * granularity,
+        (released_end + granularity - 1) / granularity * granularity);
+
+    if (begin < end)
+    {
+        madvise(reinterpret_cast<void *>(begin), end - begin, MADV_DONTNEED);
+    }
+}
+
+size_t trusted_memory_backing::obtain_mapping_granularity() const noexcept
+{
+    static size_t const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    return _kind == kind::anonymous_mapping
+        ? page_size
+        : static_cast<size_t>(1) << 21;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_ARENA_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_ARENA_H
+
+#include <allocator_address_directory.h>
+#include <allocator_guardant.h>
+#include <allocator_with_statistics.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_arena final:
+    private allocator_guardant,
+    public allocator,
+    public allocator_with_statistics,
+    private logger_guardant,
+    private typename_holder
+{
+
+private:
+    
+    void *_trusted_memory;
+
+public:
+    
+    ~allocator_arena() override;
+    
+    allocator_arena(
+        allocator_arena const &other) = delete;
+    
+    allocator_arena &operator=(
+        allocator_arena const &other) = delete;
+    
+    allocator_arena(
+        allocator_arena &&other) noexcept;
+    
+    allocator_arena &operator=(
+        allocator_arena &&other) noexcept;
+
+public:
+    
+    explicit allocator_arena(
+        size_t chunk_size,
+        allocator *parent_allocator = nullptr,
+        logger *logger = nullptr);
+
+public:
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
+    void deallocate(
+        void *at) override;
+
+public:
+    
+    void reset();
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t chunk_meta_size() noexcept;
+    
+    static constexpr size_t round_up_to_alignment(
+        size_t size) noexcept;
+    
+    static inline unsigned char *align_up(
+        unsigned char *address,
+        size_t alignment) noexcept;
+    
+    inline size_t obtain_chunk_size() const noexcept;
+    
+    inline void **&obtain_chunks() const noexcept;
+    
+    inline size_t &obtain_chunks_count() const noexcept;
+    
+    inline size_t &obtain_chunks_capacity() const noexcept;
+    
+    inline unsigned char *&obtain_top() const noexcept;
+    
+    inline unsigned char *&obtain_end() const noexcept;
+    
+    inline unsigned char *obtain_first_chunk_space() const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    static inline size_t &obtain_chunk_space_size(
+        void *chunk) noexcept;
+    
+    // endregion trusted memory layout
+    
+    void *allocate_chunk(
+        size_t space_size);
+    
+    void release_chunks() noexcept;
+    
+    bool is_owned(
+        unsigned char *at) const noexcept;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_ARENA_H
\ No newline at end of file
@@ -0,0 +1,356 @@
+#include <cstdint>
+#include <limits>
+
+#include "../include/allocator_arena.h"
+
+allocator_arena::~allocator_arena()
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard(get_typename() + "::~allocator_arena() : called");
+    release_chunks();
+    deallocate_with_guard(_trusted_memory);
+}
+
+allocator_arena::allocator_arena(
+    allocator_arena &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
+{
+    other._trusted_memory = nullptr;
+}
+
+allocator_arena &allocator_arena::operator=(
+    allocator_arena &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_chunks();
+            deallocate_with_guard(_trusted_memory);
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
+}
+
+allocator_arena::allocator_arena(
+    size_t chunk_size,
+    allocator *parent_allocator,
+    logger *logger)
+{
+    if (chunk_size == 0)
+    {
+        throw std::logic_error("chunk size must be positive");
+    }
+
+    chunk_size = round_up_to_alignment(chunk_size);
+
+    size_t const trusted_memory_size = meta_size() + chunk_size;
+    _trusted_memory = parent_allocator == nullptr
+        ? ::operator new(trusted_memory_size)
+        : parent_allocator->allocate(1, trusted_memory_size);
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<size_t *>(memory) = chunk_size;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<void ***>(memory) = nullptr;
+    memory += sizeof(void **);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+
+    obtain_top() = obtain_first_chunk_space();
+    obtain_end() = obtain_first_chunk_space() + chunk_size;
+    obtain_statistics_counters().reset();
+
+    debug_with_guard(get_typename() + "::allocator_arena(size_t, allocator *, logger *) : "
+        + "arena with chunks of " + std::to_string(chunk_size) + " bytes constructed");
+}
+
+[[nodiscard]] void *allocator_arena::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    return allocate(value_size, values_count, alignof(std::max_align_t));
+}
+
+[[nodiscard]] void *allocator_arena::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (!is_valid_alignment(alignment))
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : alignment " + std::to_string(alignment) + " is not a power of two");
+
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() - chunk_meta_size() - alignof(std::max_align_t) - alignment) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_size = round_up_to_alignment(value_size * values_count == 0
+        ? 1
+        : value_size * values_count);
+    size_t const alignment_reserve = alignment > alignof(std::max_align_t)
+        ? alignment - alignof(std::max_align_t)
+        : 0;
+
+    unsigned char *result = align_up(obtain_top(), alignment);
+
+    if (result <= obtain_end() && requested_size <= static_cast<size_t>(obtain_end() - result))
+    {
+        obtain_top() = result + requested_size;
+    }
+    else if (requested_size + alignment_reserve > obtain_chunk_size())
+    {
+        debug_with_guard([&]()
+        {
+            return get_typename() + "::allocate(size_t, size_t, size_t) : dedicated chunk for "
+                + std::to_string(requested_size) + " bytes";
+        });
+
+        result = align_up(reinterpret_cast<unsigned char *>(allocate_chunk(requested_size + alignment_reserve)) + chunk_meta_size(), alignment);
+    }
+    else
+    {
+        auto *chunk_space = reinterpret_cast<unsigned char *>(allocate_chunk(obtain_chunk_size())) + chunk_meta_size();
+        result = align_up(chunk_space, alignment);
+
+        obtain_top() = result + requested_size;
+        obtain_end() = chunk_space + obtain_chunk_size();
+    }
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.allocations_count;
+    counters.bytes_in_use += requested_size;
+
+    return result;
+}
+
+void allocator_arena::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+
+    if (!is_owned(reinterpret_cast<unsigned char *>(at)))
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    ++obtain_statistics_counters().deallocations_count;
+}
+
+void allocator_arena::reset()
+{
+    debug_with_guard(get_typename() + "::reset() : called");
+
+    release_chunks();
+
+    obtain_top() = obtain_first_chunk_space();
+    obtain_end() = obtain_first_chunk_space() + obtain_chunk_size();
+    obtain_statistics_counters().bytes_in_use = 0;
+}
+
+allocator_with_statistics::statistics allocator_arena::get_statistics() const noexcept
+{
+    allocator_with_statistics::statistics_counters counters = obtain_statistics_counters();
+    auto const bytes_free = static_cast<size_t>(obtain_end() - obtain_top());
+
+    counters.free_blocks_count = bytes_free == 0
+        ? 0
+        : 1;
+
+    return collect_statistics(counters, counters.bytes_in_use + bytes_free, bytes_free);
+}
+
+void allocator_arena::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
+}
+
+inline allocator *allocator_arena::get_allocator() const
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+inline logger *allocator_arena::get_logger() const
+{
+    return *reinterpret_cast<logger **>(_trusted_memory);
+}
+
+inline std::string allocator_arena::get_typename() const noexcept
+{
+    return "allocator_arena";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_arena::meta_size() noexcept
+{
+    return round_up_to_alignment(sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void **) + sizeof(size_t) * 2
+        + sizeof(unsigned char *) * 2 + sizeof(allocator_with_statistics::statistics_counters));
+}
+
+inline unsigned char *allocator_arena::align_up(
+    unsigned char *address,
+    size_t alignment) noexcept
+{
+    auto const address_value = reinterpret_cast<uintptr_t>(address);
+
+    return address + (alignment - address_value % alignment) % alignment;
+}
+
+constexpr size_t allocator_arena::chunk_meta_size() noexcept
+{
+    return round_up_to_alignment(sizeof(size_t));
+}
+
+constexpr size_t allocator_arena::round_up_to_alignment(
+    size_t size) noexcept
+{
+    return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+inline size_t allocator_arena::obtain_chunk_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline void **&allocator_arena::obtain_chunks() const noexcept
+{
+    return *reinterpret_cast<void ***>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t));
+}
+
+inline size_t &allocator_arena::obtain_chunks_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void **));
+}
+
+inline size_t &allocator_arena::obtain_chunks_capacity() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 2 + sizeof(void **));
+}
+
+inline unsigned char *&allocator_arena::obtain_top() const noexcept
+{
+    return *reinterpret_cast<unsigned char **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void **));
+}
+
+inline unsigned char *&allocator_arena::obtain_end() const noexcept
+{
+    return *reinterpret_cast<unsigned char **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void **) + sizeof(unsigned char *));
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_arena::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void **) + sizeof(unsigned char *) * 2);
+}
+
+inline unsigned char *allocator_arena::obtain_first_chunk_space() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size();
+}
+
+inline size_t &allocator_arena::obtain_chunk_space_size(
+    void *chunk) noexcept
+{
+    return *reinterpret_cast<size_t *>(chunk);
+}
+
+// endregion trusted memory layout
+
+void *allocator_arena::allocate_chunk(
+    size_t space_size)
+{
+    void *chunk = allocate_with_guard(1, chunk_meta_size() + space_size);
+
+    try
+    {
+        allocator_address_directory::insert(obtain_chunks(), obtain_chunks_count(), obtain_chunks_capacity(), chunk, *this);
+    }
+    catch (...)
+    {
+        deallocate_with_guard(chunk);
+
+        throw;
+    }
+
+    obtain_chunk_space_size(chunk) = space_size;
+
+    return chunk;
+}
+
+bool allocator_arena::is_owned(
+    unsigned char *at) const noexcept
+{
+    unsigned char *first_chunk_space = obtain_first_chunk_space();
+
+    if (at >= first_chunk_space && at < first_chunk_space + obtain_chunk_size())
+    {
+        return true;
+    }
+
+    void *chunk = allocator_address_directory::find_preceding(obtain_chunks(), obtain_chunks_count(), at);
+
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+
+    unsigned char *chunk_space = reinterpret_cast<unsigned char *>(chunk) + chunk_meta_size();
+
+    return at >= chunk_space && at < chunk_space + obtain_chunk_space_size(chunk);
+}
+
+void allocator_arena::release_chunks() noexcept
+{
+    void **chunks = obtain_chunks();
+
+    for (size_t i = 0; i < obtain_chunks_count(); ++i)
+    {
+        deallocate_with_guard(chunks[i]);
+    }
+
+    allocator_address_directory::release(obtain_chunks(), obtain_chunks_count(), obtain_chunks_capacity(), *this);
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <allocator_arena.h>
+#include <allocator_sorted_list.h>
+
+TEST(allocatorArenaPositiveTests, test1)
+{
+    allocator *parent_allocator = new allocator_sorted_list(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    auto *subject = new allocator_arena(256, parent_allocator);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(subject->allocate(sizeof(char), 10));
+    auto *second_block = reinterpret_cast<unsigned char *>(subject->allocate(sizeof(int), 4));
+    
+    ASSERT_EQ(first_block + alignof(std::max_align_t), second_block);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second_block) % alignof(std::max_align_t), 0);
+    
+    subject->deallocate(second_block);
+    
+    for (int i = 0; i < 100; ++i)
+    {
+        static_cast<void>(subject->allocate(sizeof(char), 100));
+    }
+    
+    static_cast<void>(subject->allocate(sizeof(char), 4096));
+    
+    subject->reset();
+    
+    ASSERT_EQ(subject->allocate(sizeof(char), 1), first_block);
+    
+    delete subject;
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(parent_allocator)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete parent_allocator;
+}
+
+TEST(allocatorArenaPositiveTests, test2)
+{
+    allocator *subject = new allocator_arena(1 << 12);
+    allocator *allocator_instance = new allocator_sorted_list(1 << 10, subject, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *block = allocator_instance->allocate(sizeof(int), 10);
+    allocator_instance->deallocate(block);
+    
+    delete allocator_instance;
+    delete subject;
+}
+
+TEST(allocatorArenaPositiveTests, test3)
+{
+    allocator *allocator_instance = new allocator_arena(1024);
+    
+    std::vector<void *> blocks;
+    for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 100, alignment);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignment, 0);
+        
+        std::fill(reinterpret_cast<unsigned char *>(block), reinterpret_cast<unsigned char *>(block) + 100, 0xCD);
+        blocks.push_back(block);
+    }
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 100, 48)), std::logic_error);
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorArenaFalsePositiveTests, test1)
+{
+    ASSERT_THROW(allocator_arena(0), std::logic_error);
+    
+    allocator_arena subject(64, nullptr);
+    
+    ASSERT_THROW(static_cast<void>(subject.allocate(std::numeric_limits<size_t>::max(), 2)), std::bad_alloc);
+    
+    allocator_arena another_subject(64, nullptr);
+    void *block = subject.allocate(sizeof(char), 32);
+    void *dedicated_chunk_block = subject.allocate(sizeof(char), 1024);
+    int foreign_value = 0;
+    
+    ASSERT_THROW(another_subject.deallocate(block), std::logic_error);
+    ASSERT_THROW(another_subject.deallocate(dedicated_chunk_block), std::logic_error);
+    ASSERT_THROW(subject.deallocate(&foreign_value), std::logic_error);
+    
+    subject.deallocate(block);
+    subject.deallocate(dedicated_chunk_block);
+}
+
+TEST(allocatorArenaFalsePositiveTests, test2)
+{
+    allocator *parent_allocator = new allocator_sorted_list(1 << 12, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    auto *subject = new allocator_arena(256, parent_allocator);
+    
+    std::vector<void *> blocks;
+    for (int i = 0; i < 20; ++i)
+    {
+        blocks.push_back(subject->allocate(sizeof(char), 100));
+    }
+    
+    auto const statistics = subject->get_statistics();
+    
+    ASSERT_THROW(static_cast<void>(subject->allocate(sizeof(char), 1 << 13)), std::bad_alloc);
+    ASSERT_EQ(subject->get_statistics().allocations_count, statistics.allocations_count);
+    ASSERT_EQ(subject->get_statistics().bytes_in_use, statistics.bytes_in_use);
+    
+    for (void *block: blocks)
+    {
+        subject->deallocate(block);
+    }
+    
+    delete subject;
+    delete parent_allocator;
+}
+
+int main(
+    int argc,
+    char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -1,16 +1,25 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BOUNDARY_TAGS_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BOUNDARY_TAGS_H
 
+#include <cstdint>
+#include <utility>
+#include <allocator_debug_mode.h>
+#include <allocator_growth_policy.h>
 #include <allocator_guardant.h>
 #include <allocator_test_utils.h>
+#include <allocator_with_compaction.h>
 #include <allocator_with_fit_mode.h>
+#include <allocator_with_statistics.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <trusted_memory_backing.h>
 
 class allocator_boundary_tags final:
     private allocator_guardant,
     public allocator_test_utils,
+    public allocator_with_compaction,
     public allocator_with_fit_mode,
+    public allocator_with_statistics,
     private logger_guardant,
     private typename_holder
 {
@@ -24,10 +33,10 @@ public:
     ~allocator_boundary_tags() override;
     
     allocator_boundary_tags(
-        allocator_boundary_tags const &other);
+        allocator_boundary_tags const &other) = delete;
     
     allocator_boundary_tags &operator=(
-        allocator_boundary_tags const &other);
+        allocator_boundary_tags const &other) = delete;
     
     allocator_boundary_tags(
         allocator_boundary_tags &&other) noexcept;
@@ -41,7 +50,9 @@ public:
         size_t space_size,
         allocator *parent_allocator = nullptr,
         logger *logger = nullptr,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing const &backing = trusted_memory_backing(),
+        allocator_growth_policy const &growth_policy = allocator_growth_policy());
 
 public:
     
@@ -49,8 +60,41 @@ public:
         size_t value_size,
         size_t values_count) override;
     
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
     void deallocate(
         void *at) override;
+    
+    void allocate_batch(
+        size_t block_size,
+        size_t blocks_count,
+        void **blocks) override;
+    
+    bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count) override;
+
+public:
+    
+    [[nodiscard]] allocator_with_compaction::handle_t allocate_relocatable(
+        size_t value_size,
+        size_t values_count) override;
+    
+    void deallocate_relocatable(
+        allocator_with_compaction::handle_t handle) override;
+    
+    [[nodiscard]] void *lock(
+        allocator_with_compaction::handle_t handle) override;
+    
+    void unlock(
+        allocator_with_compaction::handle_t handle) override;
+    
+    size_t compact(
+        size_t max_relocations_count = std::numeric_limits<size_t>::max()) override;
 
 public:
     
@@ -64,6 +108,15 @@ private:
 public:
     
     std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+    
+    std::vector<std::vector<allocator_test_utils::block_info>> get_segments_blocks_info() const noexcept override;
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
 
 private:
     
@@ -72,6 +125,179 @@ private:
 private:
     
     inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t block_header_size() noexcept;
+    
+    static constexpr size_t block_footer_size() noexcept;
+    
+    static constexpr size_t occupied_block_meta_size() noexcept;
+    
+    static constexpr size_t min_block_payload_size() noexcept;
+    
+    // whole blocks are kept multiples of the maximum alignment, so headers and payloads stay aligned
+    static constexpr size_t round_up_payload_size(
+        size_t payload_size) noexcept;
+    
+    static constexpr size_t segment_meta_size() noexcept;
+    
+    inline allocator_with_fit_mode::fit_mode &obtain_fit_mode() const noexcept;
+    
+    inline size_t obtain_space_size() const noexcept;
+    
+    inline size_t &obtain_first_level_bitmap() const noexcept;
+    
+    inline size_t obtain_first_level_count() const noexcept;
+    
+    inline uint32_t *obtain_second_level_bitmaps() const noexcept;
+    
+    inline void **obtain_free_lists_heads() const noexcept;
+    
+    inline void *obtain_first_block() const noexcept;
+    
+    inline void *obtain_space_end() const noexcept;
+    
+    inline trusted_memory_backing &obtain_trusted_memory_backing() const noexcept;
+    
+    inline allocator_growth_policy &obtain_growth_policy() const noexcept;
+    
+    inline void *&obtain_last_segment() const noexcept;
+    
+    inline size_t &obtain_segments_count() const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    inline allocator_with_compaction::handles_table *&obtain_handles_table() const noexcept;
+    
+    void release_trusted_memory();
+    
+    static inline size_t obtain_block_payload_size(
+        void *block) noexcept;
+    
+    static inline bool is_block_occupied(
+        void *block) noexcept;
+    
+    static inline void set_block_tags(
+        void *block,
+        size_t payload_size,
+        bool is_occupied) noexcept;
+    
+    static inline block_pointer_t &obtain_block_owner(
+        void *block) noexcept;
+    
+    static inline void *&obtain_previous_free_block(
+        void *block) noexcept;
+    
+    static inline void *&obtain_next_free_block(
+        void *block) noexcept;
+    
+    static inline void *obtain_next_block(
+        void *block) noexcept;
+    
+    static inline void *obtain_previous_block(
+        void *block) noexcept;
+    
+    static inline size_t obtain_leading_fragment_size(
+        void *block,
+        size_t alignment) noexcept;
+    
+    static inline void *&obtain_previous_segment(
+        void *segment) noexcept;
+    
+    static inline size_t &obtain_segment_space_size(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_first_block(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_space_end(
+        void *segment) noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region segments manipulation
+    
+    bool is_owned_block_address(
+        void *block) const noexcept;
+    
+    void *obtain_owning_space_end(
+        void *block) const noexcept;
+    
+    std::vector<std::pair<void *, void *>> obtain_segments_bounds() const;
+    
+    bool try_grow(
+        size_t requested_size);
+    
+    bool try_release_segment(
+        void *block) noexcept;
+    
+    // endregion segments manipulation
+    
+    // region two-level segregated fit index
+    
+    static constexpr size_t second_level_count_log2() noexcept;
+    
+    static constexpr size_t exact_list_probe_limit() noexcept;
+    
+    static inline void map_size_to_lists(
+        size_t size,
+        size_t &first_level_index,
+        size_t &second_level_index) noexcept;
+    
+    bool find_suitable_list(
+        size_t size,
+        size_t &first_level_index,
+        size_t &second_level_index) const noexcept;
+    
+    void *find_free_block(
+        size_t size) const noexcept;
+    
+    void *find_free_block_in_exact_list(
+        size_t size,
+        bool is_best_fit) const noexcept;
+    
+    void insert_free_block(
+        void *block) noexcept;
+    
+    void remove_free_block(
+        void *block) noexcept;
+    
+    // endregion two-level segregated fit index
+    
+    // region debug checks
+    
+    void verify_block_neighbourhood(
+        void *block,
+        char const *method_signature) const;
+    
+    bool is_block_intact(
+        void *block) const noexcept;
+    
+    void poison_free_block(
+        void *block) const noexcept;
+    
+    void poison_free_block(
+        void *block,
+        void *freed_block,
+        size_t freed_size) const noexcept;
+    
+    // endregion debug checks
+    
+    // region compaction
+    
+    allocator_with_compaction::handles_table &obtain_valid_handles_table(
+        allocator_with_compaction::handle_t handle,
+        char const *method_signature) const;
+    
+    void *relocate_next_block(
+        void *free_block);
+    
+    // endregion compaction
     
 };
 
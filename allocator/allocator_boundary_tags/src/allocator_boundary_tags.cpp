@@ -1,80 +1,1335 @@
-#include <not_implemented.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 
 #include "../include/allocator_boundary_tags.h"
 
 allocator_boundary_tags::~allocator_boundary_tags()
 {
-    throw not_implemented("allocator_boundary_tags::~allocator_boundary_tags()", "your code should be here...");
-}
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
 
-allocator_boundary_tags::allocator_boundary_tags(
-    allocator_boundary_tags const &other)
-{
-    throw not_implemented("allocator_boundary_tags::allocator_boundary_tags(allocator_boundary_tags const &)", "your code should be here...");
-}
-
-allocator_boundary_tags &allocator_boundary_tags::operator=(
-    allocator_boundary_tags const &other)
-{
-    throw not_implemented("allocator_boundary_tags &allocator_boundary_tags::operator=(allocator_boundary_tags const &)", "your code should be here...");
+    debug_with_guard(get_typename() + "::~allocator_boundary_tags() : called");
+    release_trusted_memory();
 }
 
 allocator_boundary_tags::allocator_boundary_tags(
-    allocator_boundary_tags &&other) noexcept
+    allocator_boundary_tags &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_boundary_tags::allocator_boundary_tags(allocator_boundary_tags &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_boundary_tags &allocator_boundary_tags::operator=(
     allocator_boundary_tags &&other) noexcept
 {
-    throw not_implemented("allocator_boundary_tags &allocator_boundary_tags::operator=(allocator_boundary_tags &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_trusted_memory();
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
 }
 
 allocator_boundary_tags::allocator_boundary_tags(
     size_t space_size,
     allocator *parent_allocator,
     logger *logger,
-    allocator_with_fit_mode::fit_mode allocate_fit_mode)
+    allocator_with_fit_mode::fit_mode allocate_fit_mode,
+    trusted_memory_backing const &backing,
+    allocator_growth_policy const &growth_policy)
 {
-    throw not_implemented("allocator_boundary_tags::allocator_boundary_tags(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < occupied_block_meta_size() + min_block_payload_size())
+    {
+        throw std::logic_error("space size is too small to store even a single block");
+    }
+
+    // a growing allocator may obtain a segment of any size the request demands, so its index covers the whole size range
+    size_t first_level_count;
+    size_t second_level_index;
+    map_size_to_lists(growth_policy.can_grow(1)
+        ? std::numeric_limits<size_t>::max()
+        : space_size, first_level_count, second_level_index);
+    ++first_level_count;
+
+    size_t const second_level_bitmaps_size = (first_level_count * sizeof(uint32_t) + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+    size_t const free_lists_heads_size = (first_level_count << second_level_count_log2()) * sizeof(void *);
+    size_t const blocks_offset = (meta_size() + second_level_bitmaps_size + free_lists_heads_size + alignof(std::max_align_t) - 1)
+        / alignof(std::max_align_t) * alignof(std::max_align_t);
+    size_t const trusted_memory_size = blocks_offset + space_size;
+
+    _trusted_memory = backing.allocate(trusted_memory_size, parent_allocator);
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<size_t *>(memory) = space_size;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<void **>(memory) = reinterpret_cast<unsigned char *>(_trusted_memory) + blocks_offset;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = first_level_count;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<trusted_memory_backing *>(memory) = backing;
+    memory += sizeof(trusted_memory_backing);
+
+    *reinterpret_cast<allocator_growth_policy *>(memory) = growth_policy;
+    memory += sizeof(allocator_growth_policy);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<size_t *>(memory) = 1;
+    memory += sizeof(size_t);
+
+    obtain_statistics_counters().reset();
+    memory += sizeof(allocator_with_statistics::statistics_counters);
+
+    *reinterpret_cast<allocator_with_compaction::handles_table **>(memory) = nullptr;
+    memory += sizeof(allocator_with_compaction::handles_table *);
+
+    *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(memory) = allocate_fit_mode;
+
+    std::fill(obtain_second_level_bitmaps(), obtain_second_level_bitmaps() + first_level_count, 0);
+    std::fill(obtain_free_lists_heads(), obtain_free_lists_heads() + (first_level_count << second_level_count_log2()), nullptr);
+
+    set_block_tags(obtain_first_block(), space_size - occupied_block_meta_size(), false);
+    insert_free_block(obtain_first_block());
+    poison_free_block(obtain_first_block());
+
+    debug_with_guard(get_typename() + "::allocator_boundary_tags(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode, trusted_memory_backing const &, allocator_growth_policy const &) : "
+        + "allocator with " + std::to_string(space_size) + " bytes of space constructed");
 }
 
 [[nodiscard]] void *allocator_boundary_tags::allocate(
     size_t value_size,
     size_t values_count)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_boundary_tags::allocate(size_t, size_t)", "your code should be here...");
+    return allocate(value_size, values_count, alignof(std::max_align_t));
+}
+
+[[nodiscard]] void *allocator_boundary_tags::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (!is_valid_alignment(alignment))
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : alignment " + std::to_string(alignment) + " is not a power of two");
+
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    if (values_count != 0 && value_size > ((std::numeric_limits<size_t>::max() >> 1) - alignment - allocator_debug_mode::canary_size()) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_size = round_up_payload_size(value_size * values_count + allocator_debug_mode::canary_size());
+    size_t const searched_size = alignment <= alignof(std::max_align_t)
+        ? requested_size
+        : requested_size + alignment + occupied_block_meta_size() + min_block_payload_size();
+    void *block = find_free_block(searched_size);
+
+    if (block == nullptr && try_grow(searched_size))
+    {
+        block = find_free_block(searched_size);
+    }
+
+    if (block == nullptr)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : can't allocate "
+            + std::to_string(requested_size) + " bytes");
+
+        throw std::bad_alloc();
+    }
+
+    remove_free_block(block);
+
+    size_t const leading_fragment_size = obtain_leading_fragment_size(block, alignment);
+
+    if (leading_fragment_size != 0)
+    {
+        size_t const block_payload_size = obtain_block_payload_size(block);
+        set_block_tags(block, leading_fragment_size - occupied_block_meta_size(), false);
+        insert_free_block(block);
+
+        block = obtain_next_block(block);
+        set_block_tags(block, block_payload_size - leading_fragment_size, false);
+    }
+
+    size_t const payload_size = obtain_block_payload_size(block);
+
+    if (payload_size - requested_size >= occupied_block_meta_size() + min_block_payload_size())
+    {
+        set_block_tags(block, requested_size, true);
+
+        void *rest_block = obtain_next_block(block);
+        set_block_tags(rest_block, payload_size - requested_size - occupied_block_meta_size(), false);
+        insert_free_block(rest_block);
+    }
+    else
+    {
+        if (payload_size != requested_size)
+        {
+            warning_with_guard([&]()
+            {
+                return get_typename() + "::allocate(size_t, size_t, size_t) : requested size "
+                    + std::to_string(requested_size) + " was enlarged to " + std::to_string(payload_size);
+            });
+        }
+
+        set_block_tags(block, payload_size, true);
+    }
+
+    obtain_block_owner(block) = _trusted_memory;
+    allocator_debug_mode::set_canary(reinterpret_cast<unsigned char *>(obtain_next_block(block)) - block_footer_size());
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.allocations_count;
+    counters.bytes_in_use += obtain_block_payload_size(block) + occupied_block_meta_size();
+
+    return reinterpret_cast<unsigned char *>(block) + block_header_size();
 }
 
 void allocator_boundary_tags::deallocate(
     void *at)
 {
-    throw not_implemented("void allocator_boundary_tags::deallocate(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+    void *block = reinterpret_cast<unsigned char *>(at) - block_header_size();
+
+    if (!is_owned_block_address(block)
+        || !is_block_occupied(block) || obtain_block_owner(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    if (obtain_handles_table() != nullptr && obtain_handles_table()->contains(at))
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate relocatable block by pointer");
+
+        throw std::logic_error("relocatable block must be deallocated through its handle");
+    }
+
+    if (allocator_debug_mode::is_enabled())
+    {
+        verify_block_neighbourhood(block, "deallocate(void *)");
+    }
+
+    size_t payload_size = obtain_block_payload_size(block);
+    void *freed_block = block;
+    size_t const freed_size = payload_size + occupied_block_meta_size();
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.deallocations_count;
+    counters.bytes_in_use -= freed_size;
+
+    void *next_block = obtain_next_block(block);
+    if (next_block != obtain_space_end() && !is_block_occupied(next_block))
+    {
+        remove_free_block(next_block);
+        payload_size += occupied_block_meta_size() + obtain_block_payload_size(next_block);
+    }
+
+    if (block != obtain_first_block())
+    {
+        void *previous_block = obtain_previous_block(block);
+
+        if (!is_block_occupied(previous_block))
+        {
+            remove_free_block(previous_block);
+            payload_size += occupied_block_meta_size() + obtain_block_payload_size(previous_block);
+            block = previous_block;
+        }
+    }
+
+    set_block_tags(block, payload_size, false);
+    insert_free_block(block);
+    poison_free_block(block, freed_block, freed_size);
+
+    obtain_trusted_memory_backing().release_free_pages(reinterpret_cast<unsigned char *>(block) + block_header_size() + min_block_payload_size(),
+        payload_size - min_block_payload_size(), freed_block, freed_size);
+
+    try_release_segment(block);
+}
+
+void allocator_boundary_tags::allocate_batch(
+    size_t block_size,
+    size_t blocks_count,
+    void **blocks)
+{
+    if (block_size > (std::numeric_limits<size_t>::max() >> 1) - occupied_block_meta_size())
+    {
+        error_with_guard(get_typename() + "::allocate_batch(size_t, size_t, void **) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    size_t const requested_size = round_up_payload_size(block_size + allocator_debug_mode::canary_size());
+    size_t const stride = requested_size + occupied_block_meta_size();
+    size_t allocated_count = 0;
+
+    while (allocated_count < blocks_count)
+    {
+        void *region = nullptr;
+
+        for (size_t region_blocks_count = blocks_count - allocated_count; region == nullptr && region_blocks_count != 0; region_blocks_count >>= 1)
+        {
+            if (region_blocks_count <= (std::numeric_limits<size_t>::max() >> 1) / stride)
+            {
+                region = find_free_block(region_blocks_count * stride - occupied_block_meta_size());
+            }
+        }
+
+        if (region == nullptr && try_grow(requested_size))
+        {
+            region = find_free_block(requested_size);
+        }
+
+        if (region == nullptr)
+        {
+            deallocate_batch(blocks, allocated_count);
+
+            error_with_guard(get_typename() + "::allocate_batch(size_t, size_t, void **) : can't allocate "
+                + std::to_string(blocks_count - allocated_count) + " blocks of " + std::to_string(requested_size) + " bytes");
+
+            throw std::bad_alloc();
+        }
+
+        remove_free_block(region);
+
+        size_t region_size = obtain_block_payload_size(region) + occupied_block_meta_size();
+        void *block = region;
+
+        while (allocated_count < blocks_count && region_size >= stride)
+        {
+            size_t payload_size = requested_size;
+            region_size -= stride;
+
+            if (region_size < occupied_block_meta_size() + min_block_payload_size())
+            {
+                payload_size += region_size;
+                region_size = 0;
+            }
+
+            set_block_tags(block, payload_size, true);
+            obtain_block_owner(block) = _trusted_memory;
+            allocator_debug_mode::set_canary(reinterpret_cast<unsigned char *>(obtain_next_block(block)) - block_footer_size());
+            ++counters.allocations_count;
+            counters.bytes_in_use += payload_size + occupied_block_meta_size();
+
+            blocks[allocated_count++] = reinterpret_cast<unsigned char *>(block) + block_header_size();
+            block = obtain_next_block(block);
+        }
+
+        if (region_size != 0)
+        {
+            set_block_tags(block, region_size - occupied_block_meta_size(), false);
+            insert_free_block(block);
+        }
+    }
+}
+
+bool allocator_boundary_tags::try_expand_in_place(
+    void *at,
+    size_t value_size,
+    size_t values_count)
+{
+    void *block = reinterpret_cast<unsigned char *>(at) - block_header_size();
+
+    if (!is_owned_block_address(block)
+        || !is_block_occupied(block) || obtain_block_owner(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::try_expand_in_place(void *, size_t, size_t) : attempt to expand block not owned by allocator");
+
+        throw std::logic_error("attempt to expand block not owned by allocator");
+    }
+
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() >> 1) / values_count)
+    {
+        return false;
+    }
+
+    size_t const requested_size = round_up_payload_size(value_size * values_count + allocator_debug_mode::canary_size());
+    size_t const payload_size = obtain_block_payload_size(block);
+
+    if (requested_size <= payload_size)
+    {
+        return true;
+    }
+
+    void *next_block = obtain_next_block(block);
+
+    if (next_block == obtain_space_end() || is_block_occupied(next_block)
+        || payload_size + occupied_block_meta_size() + obtain_block_payload_size(next_block) < requested_size)
+    {
+        return false;
+    }
+
+    remove_free_block(next_block);
+
+    size_t const expanded_size = payload_size + occupied_block_meta_size() + obtain_block_payload_size(next_block);
+
+    if (expanded_size - requested_size >= occupied_block_meta_size() + min_block_payload_size())
+    {
+        set_block_tags(block, requested_size, true);
+
+        void *rest_block = obtain_next_block(block);
+        set_block_tags(rest_block, expanded_size - requested_size - occupied_block_meta_size(), false);
+        insert_free_block(rest_block);
+    }
+    else
+    {
+        set_block_tags(block, expanded_size, true);
+    }
+
+    allocator_debug_mode::set_canary(reinterpret_cast<unsigned char *>(obtain_next_block(block)) - block_footer_size());
+    obtain_statistics_counters().bytes_in_use += obtain_block_payload_size(block) - payload_size;
+
+    return true;
+}
+
+allocator_with_compaction::handle_t allocator_boundary_tags::allocate_relocatable(
+    size_t value_size,
+    size_t values_count)
+{
+    void *at = allocate(value_size, values_count);
+    allocator_with_compaction::handles_table *&table = obtain_handles_table();
+
+    try
+    {
+        if (table == nullptr)
+        {
+            table = new allocator_with_compaction::handles_table;
+        }
+
+        return table->insert(at);
+    }
+    catch (...)
+    {
+        deallocate(at);
+
+        throw;
+    }
+}
+
+void allocator_boundary_tags::deallocate_relocatable(
+    allocator_with_compaction::handle_t handle)
+{
+    allocator_with_compaction::handles_table &table = obtain_valid_handles_table(handle, "deallocate_relocatable(allocator_with_compaction::handle_t)");
+
+    if (table.is_locked(handle))
+    {
+        error_with_guard(get_typename() + "::deallocate_relocatable(allocator_with_compaction::handle_t) : attempt to deallocate locked block");
+
+        throw std::logic_error("attempt to deallocate locked block");
+    }
+
+    deallocate(table.erase(handle));
+}
+
+void *allocator_boundary_tags::lock(
+    allocator_with_compaction::handle_t handle)
+{
+    return obtain_valid_handles_table(handle, "lock(allocator_with_compaction::handle_t)").lock(handle);
+}
+
+void allocator_boundary_tags::unlock(
+    allocator_with_compaction::handle_t handle)
+{
+    allocator_with_compaction::handles_table &table = obtain_valid_handles_table(handle, "unlock(allocator_with_compaction::handle_t)");
+
+    if (!table.is_locked(handle))
+    {
+        error_with_guard(get_typename() + "::unlock(allocator_with_compaction::handle_t) : attempt to unlock block which is not locked");
+
+        throw std::logic_error("attempt to unlock block which is not locked");
+    }
+
+    table.unlock(handle);
+}
+
+size_t allocator_boundary_tags::compact(
+    size_t max_relocations_count)
+{
+    if (obtain_handles_table() == nullptr || obtain_handles_table()->size() == 0)
+    {
+        return 0;
+    }
+
+    size_t relocations_count = 0;
+
+    for (auto const &segment_bounds: obtain_segments_bounds())
+    {
+        for (void *block = segment_bounds.first; block < segment_bounds.second && relocations_count < max_relocations_count;)
+        {
+            void *next_block = obtain_next_block(block);
+
+            if (is_block_occupied(block) || next_block == segment_bounds.second
+                || !obtain_handles_table()->is_movable(reinterpret_cast<unsigned char *>(next_block) + block_header_size()))
+            {
+                block = next_block;
+
+                continue;
+            }
+
+            block = relocate_next_block(block);
+            ++relocations_count;
+        }
+    }
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::compact(size_t) : " + std::to_string(relocations_count) + " blocks relocated";
+    });
+
+    return relocations_count;
 }
 
 inline void allocator_boundary_tags::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_boundary_tags::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    obtain_fit_mode() = mode;
 }
 
 inline allocator *allocator_boundary_tags::get_allocator() const
 {
-    throw not_implemented("inline allocator *allocator_boundary_tags::get_allocator() const", "your code should be here...");
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+allocator_with_statistics::statistics allocator_boundary_tags::get_statistics() const noexcept
+{
+    size_t largest_free_block_size = 0;
+
+    if (obtain_first_level_bitmap() != 0)
+    {
+        size_t const first_level_index = std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(obtain_first_level_bitmap());
+        size_t const second_level_index = std::numeric_limits<unsigned int>::digits - 1 - __builtin_clz(obtain_second_level_bitmaps()[first_level_index]);
+
+        for (void *block = obtain_free_lists_heads()[(first_level_index << second_level_count_log2()) + second_level_index];
+             block != nullptr;
+             block = obtain_next_free_block(block))
+        {
+            largest_free_block_size = std::max(largest_free_block_size, obtain_block_payload_size(block) + occupied_block_meta_size());
+        }
+    }
+
+    size_t space_size = obtain_space_size();
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        space_size += obtain_segment_space_size(segment);
+    }
+
+    return collect_statistics(obtain_statistics_counters(), space_size, largest_free_block_size);
+}
+
+void allocator_boundary_tags::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
 }
 
 std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info() const noexcept
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_boundary_tags::get_blocks_info() const noexcept", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> blocks_info;
+
+    for (auto const &segment_blocks_info: get_segments_blocks_info())
+    {
+        blocks_info.insert(blocks_info.end(), segment_blocks_info.begin(), segment_blocks_info.end());
+    }
+
+    return blocks_info;
+}
+
+std::vector<std::vector<allocator_test_utils::block_info>> allocator_boundary_tags::get_segments_blocks_info() const noexcept
+{
+    std::vector<std::vector<allocator_test_utils::block_info>> segments_blocks_info;
+
+    for (auto const &segment_bounds: obtain_segments_bounds())
+    {
+        segments_blocks_info.emplace_back();
+
+        for (void *block = segment_bounds.first; block < segment_bounds.second; block = obtain_next_block(block))
+        {
+            segments_blocks_info.back().push_back(
+                {
+                    obtain_block_payload_size(block) + occupied_block_meta_size(),
+                    is_block_occupied(block)
+                });
+        }
+    }
+
+    return segments_blocks_info;
 }
 
 inline logger *allocator_boundary_tags::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_boundary_tags::get_logger() const", "your code should be here...");
+    return *reinterpret_cast<logger **>(_trusted_memory);
 }
 
 inline std::string allocator_boundary_tags::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_boundary_tags::get_typename() const noexcept", "your code should be here...");
-}
\ No newline at end of file
+    return "allocator_boundary_tags";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_boundary_tags::meta_size() noexcept
+{
+    return (sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2
+        + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t)
+        + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(allocator_with_compaction::handles_table *) + sizeof(allocator_with_fit_mode::fit_mode) + sizeof(void *) - 1)
+        / sizeof(void *) * sizeof(void *);
+}
+
+constexpr size_t allocator_boundary_tags::block_header_size() noexcept
+{
+    return sizeof(block_size_t) + sizeof(block_pointer_t);
+}
+
+constexpr size_t allocator_boundary_tags::block_footer_size() noexcept
+{
+    return sizeof(block_size_t);
+}
+
+constexpr size_t allocator_boundary_tags::occupied_block_meta_size() noexcept
+{
+    return block_header_size() + block_footer_size();
+}
+
+constexpr size_t allocator_boundary_tags::min_block_payload_size() noexcept
+{
+    return sizeof(void *) * 2;
+}
+
+constexpr size_t allocator_boundary_tags::round_up_payload_size(
+    size_t payload_size) noexcept
+{
+    return round_up_to_max_alignment(std::max(payload_size, min_block_payload_size()) + occupied_block_meta_size()) - occupied_block_meta_size();
+}
+
+constexpr size_t allocator_boundary_tags::segment_meta_size() noexcept
+{
+    return (sizeof(void *) + sizeof(size_t) + occupied_block_meta_size() + alignof(std::max_align_t) - 1)
+        / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+inline allocator_with_fit_mode::fit_mode &allocator_boundary_tags::obtain_fit_mode() const noexcept
+{
+    return *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2 + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(allocator_with_compaction::handles_table *));
+}
+
+inline size_t allocator_boundary_tags::obtain_space_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline size_t &allocator_boundary_tags::obtain_first_level_bitmap() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *));
+}
+
+inline size_t allocator_boundary_tags::obtain_first_level_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t));
+}
+
+inline uint32_t *allocator_boundary_tags::obtain_second_level_bitmaps() const noexcept
+{
+    return reinterpret_cast<uint32_t *>(reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size());
+}
+
+inline void **allocator_boundary_tags::obtain_free_lists_heads() const noexcept
+{
+    return reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size()
+        + (obtain_first_level_count() * sizeof(uint32_t) + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *));
+}
+
+inline void *allocator_boundary_tags::obtain_first_block() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t));
+}
+
+inline void *allocator_boundary_tags::obtain_space_end() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_first_block()) + obtain_space_size();
+}
+
+inline trusted_memory_backing &allocator_boundary_tags::obtain_trusted_memory_backing() const noexcept
+{
+    return *reinterpret_cast<trusted_memory_backing *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2);
+}
+
+inline allocator_growth_policy &allocator_boundary_tags::obtain_growth_policy() const noexcept
+{
+    return *reinterpret_cast<allocator_growth_policy *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2 + sizeof(trusted_memory_backing));
+}
+
+inline void *&allocator_boundary_tags::obtain_last_segment() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2 + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy));
+}
+
+inline size_t &allocator_boundary_tags::obtain_segments_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2 + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *));
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_boundary_tags::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2 + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t));
+}
+
+inline allocator_with_compaction::handles_table *&allocator_boundary_tags::obtain_handles_table() const noexcept
+{
+    return *reinterpret_cast<allocator_with_compaction::handles_table **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) * 2 + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters));
+}
+
+void allocator_boundary_tags::release_trusted_memory()
+{
+    delete obtain_handles_table();
+
+    trusted_memory_backing const backing = obtain_trusted_memory_backing();
+
+    for (void *segment = obtain_last_segment(); segment != nullptr;)
+    {
+        void *previous_segment = obtain_previous_segment(segment);
+        backing.deallocate(segment, segment_meta_size() + obtain_segment_space_size(segment) + occupied_block_meta_size(), get_allocator());
+        segment = previous_segment;
+    }
+
+    backing.deallocate(_trusted_memory, reinterpret_cast<unsigned char *>(obtain_space_end()) - reinterpret_cast<unsigned char *>(_trusted_memory), get_allocator());
+}
+
+inline size_t allocator_boundary_tags::obtain_block_payload_size(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_size_t *>(block) & (std::numeric_limits<block_size_t>::max() >> 1);
+}
+
+inline bool allocator_boundary_tags::is_block_occupied(
+    void *block) noexcept
+{
+    return (*reinterpret_cast<block_size_t *>(block) & ~(std::numeric_limits<block_size_t>::max() >> 1)) != 0;
+}
+
+inline void allocator_boundary_tags::set_block_tags(
+    void *block,
+    size_t payload_size,
+    bool is_occupied) noexcept
+{
+    block_size_t const tag = is_occupied
+        ? payload_size | ~(std::numeric_limits<block_size_t>::max() >> 1)
+        : payload_size;
+
+    *reinterpret_cast<block_size_t *>(block) = tag;
+    *reinterpret_cast<block_size_t *>(reinterpret_cast<unsigned char *>(block) + block_header_size() + payload_size) = tag;
+}
+
+inline allocator::block_pointer_t &allocator_boundary_tags::obtain_block_owner(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_pointer_t *>(reinterpret_cast<unsigned char *>(block) + sizeof(block_size_t));
+}
+
+inline void *&allocator_boundary_tags::obtain_previous_free_block(
+    void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(block) + block_header_size());
+}
+
+inline void *&allocator_boundary_tags::obtain_next_free_block(
+    void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(block) + block_header_size() + sizeof(void *));
+}
+
+inline void *allocator_boundary_tags::obtain_next_block(
+    void *block) noexcept
+{
+    return reinterpret_cast<unsigned char *>(block) + occupied_block_meta_size() + obtain_block_payload_size(block);
+}
+
+inline void *allocator_boundary_tags::obtain_previous_block(
+    void *block) noexcept
+{
+    auto *previous_block_footer = reinterpret_cast<unsigned char *>(block) - block_footer_size();
+    size_t const previous_block_payload_size = *reinterpret_cast<block_size_t *>(previous_block_footer) & (std::numeric_limits<block_size_t>::max() >> 1);
+
+    return previous_block_footer - previous_block_payload_size - block_header_size();
+}
+
+inline size_t allocator_boundary_tags::obtain_leading_fragment_size(
+    void *block,
+    size_t alignment) noexcept
+{
+    auto const payload_address = reinterpret_cast<uintptr_t>(block) + block_header_size();
+    size_t leading_fragment_size = (alignment - payload_address % alignment) % alignment;
+
+    while (leading_fragment_size != 0 && leading_fragment_size < occupied_block_meta_size() + min_block_payload_size())
+    {
+        leading_fragment_size += alignment;
+    }
+
+    return leading_fragment_size;
+}
+
+inline void *&allocator_boundary_tags::obtain_previous_segment(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<void **>(segment);
+}
+
+inline size_t &allocator_boundary_tags::obtain_segment_space_size(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(segment) + sizeof(void *));
+}
+
+inline void *allocator_boundary_tags::obtain_segment_first_block(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(segment) + segment_meta_size();
+}
+
+inline void *allocator_boundary_tags::obtain_segment_space_end(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_segment_first_block(segment)) + obtain_segment_space_size(segment);
+}
+
+// endregion trusted memory layout
+
+// region segments manipulation
+
+bool allocator_boundary_tags::is_owned_block_address(
+    void *block) const noexcept
+{
+    return obtain_owning_space_end(block) != nullptr;
+}
+
+void *allocator_boundary_tags::obtain_owning_space_end(
+    void *block) const noexcept
+{
+    if (block >= obtain_first_block() && block < obtain_space_end())
+    {
+        return obtain_space_end();
+    }
+
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        if (block >= obtain_segment_first_block(segment) && block < obtain_segment_space_end(segment))
+        {
+            return obtain_segment_space_end(segment);
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<std::pair<void *, void *>> allocator_boundary_tags::obtain_segments_bounds() const
+{
+    std::vector<std::pair<void *, void *>> segments_bounds { { obtain_first_block(), obtain_space_end() } };
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        segments_bounds.emplace(segments_bounds.begin() + 1, obtain_segment_first_block(segment), obtain_segment_space_end(segment));
+    }
+
+    return segments_bounds;
+}
+
+bool allocator_boundary_tags::try_grow(
+    size_t requested_size)
+{
+    allocator_growth_policy const &growth_policy = obtain_growth_policy();
+
+    if (!growth_policy.can_grow(obtain_segments_count())
+        || requested_size > (std::numeric_limits<size_t>::max() >> 1) - segment_meta_size() - occupied_block_meta_size() * 2)
+    {
+        return false;
+    }
+
+    size_t const segment_space_size = growth_policy.obtain_segment_size(obtain_space_size(), requested_size + occupied_block_meta_size());
+    void *segment = obtain_trusted_memory_backing().allocate(segment_meta_size() + segment_space_size + occupied_block_meta_size(), get_allocator());
+
+    obtain_previous_segment(segment) = obtain_last_segment();
+    obtain_segment_space_size(segment) = segment_space_size;
+    obtain_last_segment() = segment;
+    ++obtain_segments_count();
+
+    // zero-sized occupied sentinels around the segment space stop coalescing at its bounds
+    void *block = obtain_segment_first_block(segment);
+    set_block_tags(reinterpret_cast<unsigned char *>(block) - occupied_block_meta_size(), 0, true);
+    set_block_tags(obtain_segment_space_end(segment), 0, true);
+
+    set_block_tags(block, segment_space_size - occupied_block_meta_size(), false);
+    insert_free_block(block);
+    poison_free_block(block);
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::allocate(size_t, size_t, size_t) : segment of "
+            + std::to_string(segment_space_size) + " bytes allocated";
+    });
+
+    return true;
+}
+
+bool allocator_boundary_tags::try_release_segment(
+    void *block) noexcept
+{
+    if (!obtain_growth_policy().is_releasing_empty_segments())
+    {
+        return false;
+    }
+
+    void *segment = reinterpret_cast<unsigned char *>(block) - segment_meta_size();
+    void *next_segment = nullptr;
+
+    for (void *current_segment = obtain_last_segment(); current_segment != segment; current_segment = obtain_previous_segment(current_segment))
+    {
+        if (current_segment == nullptr)
+        {
+            return false;
+        }
+
+        next_segment = current_segment;
+    }
+
+    if (obtain_block_payload_size(block) + occupied_block_meta_size() != obtain_segment_space_size(segment))
+    {
+        return false;
+    }
+
+    remove_free_block(block);
+
+    (next_segment == nullptr
+        ? obtain_last_segment()
+        : obtain_previous_segment(next_segment)) = obtain_previous_segment(segment);
+    --obtain_segments_count();
+
+    size_t const segment_space_size = obtain_segment_space_size(segment);
+    obtain_trusted_memory_backing().deallocate(segment, segment_meta_size() + segment_space_size + occupied_block_meta_size(), get_allocator());
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::deallocate(void *) : empty segment of "
+            + std::to_string(segment_space_size) + " bytes released";
+    });
+
+    return true;
+}
+
+// endregion segments manipulation
+
+// region two-level segregated fit index
+
+constexpr size_t allocator_boundary_tags::second_level_count_log2() noexcept
+{
+    return 4;
+}
+
+constexpr size_t allocator_boundary_tags::exact_list_probe_limit() noexcept
+{
+    return 8;
+}
+
+inline void allocator_boundary_tags::map_size_to_lists(
+    size_t size,
+    size_t &first_level_index,
+    size_t &second_level_index) noexcept
+{
+    if (size < (static_cast<size_t>(1) << second_level_count_log2()))
+    {
+        first_level_index = 0;
+        second_level_index = size;
+
+        return;
+    }
+
+    size_t const most_significant_bit = std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(size);
+
+    first_level_index = most_significant_bit - second_level_count_log2() + 1;
+    second_level_index = (size >> (most_significant_bit - second_level_count_log2())) - (static_cast<size_t>(1) << second_level_count_log2());
+}
+
+bool allocator_boundary_tags::find_suitable_list(
+    size_t size,
+    size_t &first_level_index,
+    size_t &second_level_index) const noexcept
+{
+    if (size >= (static_cast<size_t>(1) << second_level_count_log2()))
+    {
+        size_t const most_significant_bit = std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(size);
+        size += (static_cast<size_t>(1) << (most_significant_bit - second_level_count_log2())) - 1;
+    }
+
+    map_size_to_lists(size, first_level_index, second_level_index);
+
+    if (first_level_index >= obtain_first_level_count())
+    {
+        return false;
+    }
+
+    uint32_t second_level_bitmap = obtain_second_level_bitmaps()[first_level_index] & (~static_cast<uint32_t>(0) << second_level_index);
+
+    if (second_level_bitmap == 0)
+    {
+        size_t const first_level_bitmap = first_level_index + 1 >= std::numeric_limits<size_t>::digits
+            ? 0
+            : obtain_first_level_bitmap() & (~static_cast<size_t>(0) << (first_level_index + 1));
+
+        if (first_level_bitmap == 0)
+        {
+            return false;
+        }
+
+        first_level_index = __builtin_ctzll(first_level_bitmap);
+        second_level_bitmap = obtain_second_level_bitmaps()[first_level_index];
+    }
+
+    second_level_index = __builtin_ctz(second_level_bitmap);
+
+    return true;
+}
+
+void *allocator_boundary_tags::find_free_block(
+    size_t size) const noexcept
+{
+    void **free_lists_heads = obtain_free_lists_heads();
+    size_t first_level_index;
+    size_t second_level_index;
+
+    switch (obtain_fit_mode())
+    {
+        case allocator_with_fit_mode::fit_mode::the_best_fit:
+        {
+            void *block = find_free_block_in_exact_list(size, true);
+
+            if (block != nullptr)
+            {
+                return block;
+            }
+
+            break;
+        }
+        case allocator_with_fit_mode::fit_mode::the_worst_fit:
+        {
+            if (obtain_first_level_bitmap() == 0)
+            {
+                return nullptr;
+            }
+
+            first_level_index = std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(obtain_first_level_bitmap());
+            second_level_index = std::numeric_limits<unsigned int>::digits - 1 - __builtin_clz(obtain_second_level_bitmaps()[first_level_index]);
+
+            void *head = free_lists_heads[(first_level_index << second_level_count_log2()) + second_level_index];
+
+            if (obtain_block_payload_size(head) >= size)
+            {
+                return head;
+            }
+
+            break;
+        }
+        case allocator_with_fit_mode::fit_mode::first_fit:
+            break;
+    }
+
+    if (find_suitable_list(size, first_level_index, second_level_index))
+    {
+        return free_lists_heads[(first_level_index << second_level_count_log2()) + second_level_index];
+    }
+
+    return obtain_fit_mode() == allocator_with_fit_mode::fit_mode::the_best_fit
+        ? nullptr
+        : find_free_block_in_exact_list(size, false);
+}
+
+void *allocator_boundary_tags::find_free_block_in_exact_list(
+    size_t size,
+    bool is_best_fit) const noexcept
+{
+    size_t first_level_index;
+    size_t second_level_index;
+    map_size_to_lists(size, first_level_index, second_level_index);
+
+    if (first_level_index >= obtain_first_level_count())
+    {
+        return nullptr;
+    }
+
+    void *suitable_block = nullptr;
+    size_t probed_blocks_count = 0;
+
+    // the rounded up search skips the list holding the requested size itself, so a bounded number of its blocks is checked one by one
+    for (void *block = obtain_free_lists_heads()[(first_level_index << second_level_count_log2()) + second_level_index];
+        block != nullptr && probed_blocks_count < exact_list_probe_limit(); block = obtain_next_free_block(block), ++probed_blocks_count)
+    {
+        size_t const payload_size = obtain_block_payload_size(block);
+
+        if (payload_size < size || (suitable_block != nullptr && payload_size >= obtain_block_payload_size(suitable_block)))
+        {
+            continue;
+        }
+
+        suitable_block = block;
+
+        if (!is_best_fit || payload_size == size)
+        {
+            break;
+        }
+    }
+
+    return suitable_block;
+}
+
+void allocator_boundary_tags::insert_free_block(
+    void *block) noexcept
+{
+    obtain_statistics_counters().on_free_block_appeared(obtain_block_payload_size(block) + occupied_block_meta_size());
+
+    size_t first_level_index;
+    size_t second_level_index;
+    map_size_to_lists(obtain_block_payload_size(block), first_level_index, second_level_index);
+
+    void *&head = obtain_free_lists_heads()[(first_level_index << second_level_count_log2()) + second_level_index];
+
+    obtain_previous_free_block(block) = nullptr;
+    obtain_next_free_block(block) = head;
+
+    if (head != nullptr)
+    {
+        obtain_previous_free_block(head) = block;
+    }
+
+    head = block;
+
+    obtain_second_level_bitmaps()[first_level_index] |= static_cast<uint32_t>(1) << second_level_index;
+    obtain_first_level_bitmap() |= static_cast<size_t>(1) << first_level_index;
+}
+
+void allocator_boundary_tags::remove_free_block(
+    void *block) noexcept
+{
+    obtain_statistics_counters().on_free_block_disappeared(obtain_block_payload_size(block) + occupied_block_meta_size());
+
+    size_t first_level_index;
+    size_t second_level_index;
+    map_size_to_lists(obtain_block_payload_size(block), first_level_index, second_level_index);
+
+    void *&head = obtain_free_lists_heads()[(first_level_index << second_level_count_log2()) + second_level_index];
+    void *previous_free_block = obtain_previous_free_block(block);
+    void *next_free_block = obtain_next_free_block(block);
+
+    (previous_free_block == nullptr
+        ? head
+        : obtain_next_free_block(previous_free_block)) = next_free_block;
+
+    if (next_free_block != nullptr)
+    {
+        obtain_previous_free_block(next_free_block) = previous_free_block;
+    }
+
+    if (head == nullptr)
+    {
+        uint32_t &second_level_bitmap = obtain_second_level_bitmaps()[first_level_index];
+        second_level_bitmap &= ~(static_cast<uint32_t>(1) << second_level_index);
+
+        if (second_level_bitmap == 0)
+        {
+            obtain_first_level_bitmap() &= ~(static_cast<size_t>(1) << first_level_index);
+        }
+    }
+}
+
+// endregion two-level segregated fit index
+
+// region debug checks
+
+void allocator_boundary_tags::verify_block_neighbourhood(
+    void *block,
+    char const *method_signature) const
+{
+    void *corrupted_block = nullptr;
+
+    if (!is_block_intact(block))
+    {
+        corrupted_block = block;
+    }
+    else if (obtain_next_block(block) != obtain_space_end() && obtain_block_payload_size(obtain_next_block(block)) != 0
+        && !is_block_intact(obtain_next_block(block)))
+    {
+        corrupted_block = obtain_next_block(block);
+    }
+    else if (block != obtain_first_block() && obtain_block_payload_size(obtain_previous_block(block)) != 0
+        && !is_block_intact(obtain_previous_block(block)))
+    {
+        corrupted_block = obtain_previous_block(block);
+    }
+
+    if (corrupted_block == nullptr)
+    {
+        return;
+    }
+
+    critical_with_guard(get_typename() + "::" + method_signature + " : memory corruption detected in block at offset "
+        + std::to_string(reinterpret_cast<unsigned char *>(corrupted_block) - reinterpret_cast<unsigned char *>(obtain_first_block())));
+
+    throw std::logic_error("memory corruption detected");
+}
+
+bool allocator_boundary_tags::is_block_intact(
+    void *block) const noexcept
+{
+    auto *block_end = reinterpret_cast<unsigned char *>(obtain_next_block(block));
+
+    void *space_end = obtain_owning_space_end(block);
+
+    if (space_end == nullptr || block_end > space_end
+        || *reinterpret_cast<block_size_t *>(block_end - block_footer_size()) != *reinterpret_cast<block_size_t *>(block))
+    {
+        return false;
+    }
+
+    if (is_block_occupied(block))
+    {
+        return obtain_block_owner(block) == _trusted_memory
+            && allocator_debug_mode::is_canary_intact(block_end - block_footer_size());
+    }
+
+    return obtain_trusted_memory_backing().is_mapped()
+        || allocator_debug_mode::is_poisoned(reinterpret_cast<unsigned char *>(block) + block_header_size() + min_block_payload_size(),
+            std::min(obtain_block_payload_size(block) - min_block_payload_size(), allocator_debug_mode::poison_check_size()));
+}
+
+void allocator_boundary_tags::poison_free_block(
+    void *block) const noexcept
+{
+    allocator_debug_mode::poison(reinterpret_cast<unsigned char *>(block) + block_header_size() + min_block_payload_size(),
+        obtain_block_payload_size(block) - min_block_payload_size());
+}
+
+void allocator_boundary_tags::poison_free_block(
+    void *block,
+    void *freed_block,
+    size_t freed_size) const noexcept
+{
+    // the rest of a coalesced block is poisoned already, except for the absorbed neighbour tags around the freed bytes
+    size_t const absorbed_tags_size = occupied_block_meta_size() + min_block_payload_size();
+    auto const payload_begin = reinterpret_cast<uintptr_t>(block) + block_header_size() + min_block_payload_size();
+    auto const payload_end = reinterpret_cast<uintptr_t>(obtain_next_block(block)) - block_footer_size();
+    auto const freed_begin = reinterpret_cast<uintptr_t>(freed_block);
+    auto const poisoned_begin = std::max(payload_begin, freed_begin - absorbed_tags_size);
+    auto const poisoned_end = std::min(payload_end, freed_begin + freed_size + absorbed_tags_size);
+
+    if (poisoned_begin < poisoned_end)
+    {
+        allocator_debug_mode::poison(reinterpret_cast<void *>(poisoned_begin), poisoned_end - poisoned_begin);
+    }
+}
+
+// endregion debug checks
+
+// region compaction
+
+allocator_with_compaction::handles_table &allocator_boundary_tags::obtain_valid_handles_table(
+    allocator_with_compaction::handle_t handle,
+    char const *method_signature) const
+{
+    allocator_with_compaction::handles_table *table = obtain_handles_table();
+
+    if (table == nullptr || !table->is_valid(handle))
+    {
+        error_with_guard(get_typename() + "::" + method_signature + " : invalid relocatable block handle " + std::to_string(handle));
+
+        throw std::logic_error("invalid relocatable block handle");
+    }
+
+    return *table;
+}
+
+void *allocator_boundary_tags::relocate_next_block(
+    void *free_block)
+{
+    void *next_block = obtain_next_block(free_block);
+    void *following_block = obtain_next_block(next_block);
+    size_t payload_size = obtain_block_payload_size(free_block);
+    size_t const relocated_size = occupied_block_meta_size() + obtain_block_payload_size(next_block);
+
+    obtain_handles_table()->relocate(
+        reinterpret_cast<unsigned char *>(next_block) + block_header_size(),
+        reinterpret_cast<unsigned char *>(free_block) + block_header_size());
+
+    remove_free_block(free_block);
+    std::memmove(free_block, next_block, relocated_size);
+
+    if (following_block != obtain_space_end() && !is_block_occupied(following_block))
+    {
+        remove_free_block(following_block);
+        payload_size += occupied_block_meta_size() + obtain_block_payload_size(following_block);
+    }
+
+    void *relocated_free_block = reinterpret_cast<unsigned char *>(free_block) + relocated_size;
+    set_block_tags(relocated_free_block, payload_size, false);
+    insert_free_block(relocated_free_block);
+    poison_free_block(relocated_free_block, next_block, relocated_size);
+
+    obtain_trusted_memory_backing().release_free_pages(reinterpret_cast<unsigned char *>(relocated_free_block) + block_header_size() + min_block_payload_size(),
+        payload_size - min_block_payload_size(), next_block, relocated_size);
+
+    return relocated_free_block;
+}
+
+// endregion compaction
\ No newline at end of file
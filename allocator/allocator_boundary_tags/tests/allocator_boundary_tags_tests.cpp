@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <allocator.h>
 #include <allocator_boundary_tags.h>
@@ -29,6 +30,12 @@ logger *create_logger(
     return logger_instance;
 }
 
+size_t round_up_to_max_alignment(
+    size_t size)
+{
+    return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
 TEST(positiveTests, test1)
 {
     logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -103,6 +110,29 @@ TEST(positiveTests, test2)
     delete logger_instance;
 }
 
+TEST(positiveTests, test5)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(1 << 24, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing(trusted_memory_backing::kind::anonymous_mapping, 1 << 16));
+    
+    auto *block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    std::fill(block, block + (1 << 23), 0xAB);
+    allocator_instance->deallocate(block);
+    
+    block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    
+    ASSERT_EQ(block[1 << 22], 0);
+    
+    allocator_instance->deallocate(block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
 TEST(falsePositiveTests, test1)
 {
     logger *logger_instance = create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -120,6 +150,415 @@ TEST(falsePositiveTests, test1)
     delete logger_instance;
 }
 
+TEST(positiveTests, test3)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < 256; ++i)
+    {
+        blocks.push_back(allocator_instance->allocate(1, 16 + (i * 37) % 200));
+    }
+    
+    for (size_t i = 0; i < blocks.size(); i += 2)
+    {
+        allocator_instance->deallocate(blocks[i]);
+    }
+    
+    for (size_t i = 0; i < blocks.size(); i += 2)
+    {
+        blocks[i] = allocator_instance->allocate(1, 16 + (i * 37) % 200);
+    }
+    
+    for (auto *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 1 << 16);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test4)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit);
+    
+    void *first_block = allocator_instance->allocate(1, 1000);
+    void *separator = allocator_instance->allocate(1, 16);
+    void *second_block = allocator_instance->allocate(1, 200);
+    void *tail_separator = allocator_instance->allocate(1, 16);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(second_block);
+    
+    ASSERT_EQ(allocator_instance->allocate(1, 200), second_block);
+    ASSERT_EQ(allocator_instance->allocate(1, 1000), first_block);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(second_block);
+    allocator_instance->deallocate(separator);
+    allocator_instance->deallocate(tail_separator);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test6)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    
+    allocator_instance->deallocate(second_block);
+    
+    ASSERT_TRUE(allocator_instance->try_expand_in_place(first_block, sizeof(unsigned char), 180));
+    ASSERT_FALSE(allocator_instance->try_expand_in_place(first_block, sizeof(unsigned char), 300));
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 4);
+    ASSERT_EQ(actual_blocks_state[0].block_size, round_up_to_max_alignment(180 + allocator_debug_mode::canary_size() + 24));
+    ASSERT_EQ(actual_blocks_state[1].block_size, round_up_to_max_alignment(100 + allocator_debug_mode::canary_size() + 24) * 2
+        - round_up_to_max_alignment(180 + allocator_debug_mode::canary_size() + 24));
+    ASSERT_FALSE(actual_blocks_state[1].is_block_occupied);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(third_block);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test7)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 100, alignment);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignment, 0);
+        
+        std::fill(reinterpret_cast<unsigned char *>(block), reinterpret_cast<unsigned char *>(block) + 100, 0xCD);
+        blocks.push_back(block);
+    }
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 100, 48)), std::logic_error);
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test8)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *blocks[20];
+    allocator_instance->allocate_batch(sizeof(unsigned char) * 64, 20, blocks);
+    
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::fill(reinterpret_cast<unsigned char *>(blocks[i]), reinterpret_cast<unsigned char *>(blocks[i]) + 64, 0xAB);
+        
+        if (i != 0)
+        {
+            ASSERT_GT(blocks[i], blocks[i - 1]);
+        }
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 21);
+    ASSERT_FALSE(actual_blocks_state[20].is_block_occupied);
+    
+    std::reverse(blocks, blocks + 20);
+    allocator_instance->deallocate_batch(blocks, 20);
+    
+    void *oversized_blocks[10];
+    ASSERT_THROW(allocator_instance->allocate_batch(sizeof(unsigned char) * 1000, 10, oversized_blocks), std::bad_alloc);
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test9)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    auto *compacting_allocator = dynamic_cast<allocator_with_compaction *>(allocator_instance);
+    
+    allocator_with_compaction::handle_t handles[6];
+    
+    for (size_t i = 0; i < 6; ++i)
+    {
+        handles[i] = compacting_allocator->allocate_relocatable(sizeof(unsigned char), 100);
+        
+        auto *values = reinterpret_cast<unsigned char *>(compacting_allocator->lock(handles[i]));
+        std::fill(values, values + 100, static_cast<unsigned char>(i));
+        compacting_allocator->unlock(handles[i]);
+    }
+    
+    compacting_allocator->deallocate_relocatable(handles[0]);
+    compacting_allocator->deallocate_relocatable(handles[2]);
+    compacting_allocator->deallocate_relocatable(handles[4]);
+    
+    ASSERT_EQ(dynamic_cast<allocator_with_statistics *>(allocator_instance)->get_statistics().free_blocks_count, 4);
+    
+    void *pinned = compacting_allocator->lock(handles[3]);
+    
+    ASSERT_EQ(compacting_allocator->compact(), 2);
+    ASSERT_EQ(compacting_allocator->lock(handles[3]), pinned);
+    
+    compacting_allocator->unlock(handles[3]);
+    compacting_allocator->unlock(handles[3]);
+    
+    ASSERT_THROW(compacting_allocator->unlock(handles[3]), std::logic_error);
+    ASSERT_EQ(compacting_allocator->compact(), 2);
+    ASSERT_EQ(compacting_allocator->compact(), 0);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 4);
+    ASSERT_FALSE(actual_blocks_state[3].is_block_occupied);
+    ASSERT_EQ(dynamic_cast<allocator_with_statistics *>(allocator_instance)->get_statistics().free_blocks_count, 1);
+    
+    for (size_t i: { 1, 3, 5 })
+    {
+        auto *values = reinterpret_cast<unsigned char *>(compacting_allocator->lock(handles[i]));
+        
+        ASSERT_TRUE(std::all_of(values, values + 100, [i](unsigned char value) { return value == i; }));
+        
+        compacting_allocator->unlock(handles[i]);
+        compacting_allocator->deallocate_relocatable(handles[i]);
+    }
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test10)
+{
+    for (auto mode: { allocator_with_fit_mode::fit_mode::first_fit, allocator_with_fit_mode::fit_mode::the_best_fit, allocator_with_fit_mode::fit_mode::the_worst_fit })
+    {
+        allocator *allocator_instance = new allocator_boundary_tags(3000, nullptr, nullptr, mode);
+        
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 2950);
+        
+        ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 1)), std::bad_alloc);
+        
+        allocator_instance->deallocate(block);
+        
+        delete allocator_instance;
+    }
+    
+    allocator *allocator_instance = new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 1000);
+    void *first_separator = allocator_instance->allocate(sizeof(unsigned char), 16);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 1032);
+    void *second_separator = allocator_instance->allocate(sizeof(unsigned char), 16);
+    
+    allocator_instance->deallocate(second_block);
+    allocator_instance->deallocate(first_block);
+    
+    ASSERT_EQ(allocator_instance->allocate(sizeof(unsigned char), 1016), second_block);
+    
+    allocator_instance->deallocate(second_block);
+    allocator_instance->deallocate(first_separator);
+    allocator_instance->deallocate(second_separator);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test11)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(1024, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing(), allocator_growth_policy(4096, 3));
+    auto *allocator_test_utils_instance = dynamic_cast<allocator_test_utils *>(allocator_instance);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 2000);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 1100);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 8000);
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 8000)), std::bad_alloc);
+    
+    auto segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 3);
+    ASSERT_EQ(segments_blocks_info[0].size(), 1);
+    ASSERT_EQ(segments_blocks_info[1].size(), 3);
+    ASSERT_EQ(segments_blocks_info[2].size(), 1);
+    ASSERT_EQ(segments_blocks_info[2][0].block_size, round_up_to_max_alignment(8000 + allocator_debug_mode::canary_size()
+        + sizeof(allocator::block_size_t) * 2 + sizeof(allocator::block_pointer_t)));
+    
+    size_t blocks_size = 0;
+    for (auto const &block_info: allocator_test_utils_instance->get_blocks_info())
+    {
+        blocks_size += block_info.block_size;
+    }
+    
+    auto statistics = dynamic_cast<allocator_with_statistics *>(allocator_instance)->get_statistics();
+    
+    ASSERT_EQ(statistics.bytes_in_use + statistics.bytes_free, blocks_size);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(third_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 2);
+    ASSERT_EQ(segments_blocks_info[1].size(), 3);
+    
+    allocator_instance->deallocate(second_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 1);
+    ASSERT_EQ(allocator_test_utils_instance->get_blocks_info(), segments_blocks_info[0]);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test12)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(1024, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing(), allocator_growth_policy(4096, 2));
+    auto *allocator_test_utils_instance = dynamic_cast<allocator_test_utils *>(allocator_instance);
+    
+    void *block = allocator_instance->allocate(sizeof(unsigned char), 1 << 20);
+    
+    auto segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 2);
+    ASSERT_EQ(segments_blocks_info[1].size(), 1);
+    ASSERT_TRUE(segments_blocks_info[1][0].is_block_occupied);
+    
+    allocator_instance->deallocate(block);
+    
+    ASSERT_EQ(allocator_test_utils_instance->get_segments_blocks_info().size(), 1);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test13)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t size = 1; size <= 50; size += 7)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), size);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t), 0);
+        
+        blocks.push_back(block);
+    }
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test2)
+{
+    allocator *allocator_instance = new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    allocator *another_allocator_instance = new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *block = allocator_instance->allocate(1, 100);
+    
+    ASSERT_THROW(another_allocator_instance->deallocate(block), std::logic_error);
+    
+    allocator_instance->deallocate(block);
+    
+    delete another_allocator_instance;
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test3)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    std::fill(first_block, second_block, 0xCD);
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test4)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    std::fill(second_block, third_block, 0xCD);
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test5)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    allocator_instance->deallocate(second_block);
+    second_block[32] = 0xCD;
+    
+    ASSERT_THROW(allocator_instance->deallocate(third_block), std::logic_error);
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
 int main(
     int argc,
     char *argv[])
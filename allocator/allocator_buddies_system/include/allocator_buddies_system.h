@@ -1,16 +1,21 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BUDDIES_SYSTEM_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BUDDIES_SYSTEM_H
 
+#include <utility>
+#include <allocator_growth_policy.h>
 #include <allocator_guardant.h>
 #include <allocator_test_utils.h>
 #include <allocator_with_fit_mode.h>
+#include <allocator_with_statistics.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <trusted_memory_backing.h>
 
 class allocator_buddies_system final:
     private allocator_guardant,
     public allocator_test_utils,
     public allocator_with_fit_mode,
+    public allocator_with_statistics,
     private logger_guardant,
     private typename_holder
 {
@@ -24,10 +29,10 @@ public:
     ~allocator_buddies_system() override;
     
     allocator_buddies_system(
-        allocator_buddies_system const &other);
+        allocator_buddies_system const &other) = delete;
     
     allocator_buddies_system &operator=(
-        allocator_buddies_system const &other);
+        allocator_buddies_system const &other) = delete;
     
     allocator_buddies_system(
         allocator_buddies_system &&other) noexcept;
@@ -41,7 +46,9 @@ public:
         size_t space_size_power_of_two,
         allocator *parent_allocator = nullptr,
         logger *logger = nullptr,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing const &backing = trusted_memory_backing(),
+        allocator_growth_policy const &growth_policy = allocator_growth_policy());
 
 public:
     
@@ -49,6 +56,11 @@ public:
         size_t value_size,
         size_t values_count) override;
     
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
     void deallocate(
         void *at) override;
 
@@ -64,6 +76,15 @@ private:
 public:
     
     std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+    
+    std::vector<std::vector<allocator_test_utils::block_info>> get_segments_blocks_info() const noexcept override;
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
 
 private:
     
@@ -72,6 +93,130 @@ private:
 private:
     
     inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t occupied_block_meta_size() noexcept;
+    
+    static constexpr size_t free_block_meta_size() noexcept;
+    
+    static constexpr unsigned char min_block_power() noexcept;
+    
+    static constexpr size_t segment_meta_size() noexcept;
+    
+    inline void *&obtain_first_free_block() const noexcept;
+    
+    inline allocator_with_fit_mode::fit_mode &obtain_fit_mode() const noexcept;
+    
+    inline unsigned char obtain_space_power() const noexcept;
+    
+    inline void *obtain_first_block() const noexcept;
+    
+    inline void *obtain_space_end() const noexcept;
+    
+    inline trusted_memory_backing &obtain_trusted_memory_backing() const noexcept;
+    
+    inline allocator_growth_policy &obtain_growth_policy() const noexcept;
+    
+    inline void *&obtain_last_segment() const noexcept;
+    
+    inline size_t &obtain_segments_count() const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    // free blocks count per power, indexed by power, the largest free block is the highest non-empty power
+    inline size_t *obtain_free_blocks_counts() const noexcept;
+    
+    void release_trusted_memory();
+    
+    static inline bool is_block_occupied(
+        void *block) noexcept;
+    
+    static inline unsigned char obtain_block_power(
+        void *block) noexcept;
+    
+    static inline void set_block_header(
+        void *block,
+        bool is_occupied,
+        unsigned char power) noexcept;
+    
+    static inline bool is_block_forwarding(
+        void *block) noexcept;
+    
+    static inline size_t obtain_forwarding_offset(
+        void *block) noexcept;
+    
+    static inline void set_forwarding_header(
+        void *header,
+        size_t offset) noexcept;
+    
+    static inline void *&obtain_previous_free_block(
+        void *block) noexcept;
+    
+    static inline void *&obtain_next_free_block(
+        void *block) noexcept;
+    
+    static inline block_pointer_t &obtain_block_owner(
+        void *block) noexcept;
+    
+    static inline void *obtain_buddy(
+        void *block,
+        void *space_first_block) noexcept;
+    
+    static inline void *&obtain_previous_segment(
+        void *segment) noexcept;
+    
+    static inline unsigned char &obtain_segment_space_power(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_first_block(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_space_end(
+        void *segment) noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region segments manipulation
+    
+    void *obtain_owning_space_first_block(
+        void *block,
+        unsigned char &space_power) const noexcept;
+    
+    std::vector<std::pair<void *, void *>> obtain_segments_bounds() const;
+    
+    bool is_alignment_natural(
+        size_t alignment) const noexcept;
+    
+    bool try_grow(
+        unsigned char requested_power);
+    
+    bool try_release_segment(
+        void *block) noexcept;
+    
+    // endregion segments manipulation
+    
+    // region free list manipulation
+    
+    unsigned char obtain_requested_power(
+        size_t size,
+        size_t alignment) const noexcept;
+    
+    void *find_free_block(
+        unsigned char requested_power) const noexcept;
+    
+    void push_free_block(
+        void *block,
+        unsigned char power) noexcept;
+    
+    void remove_free_block(
+        void *block) noexcept;
+    
+    // endregion free list manipulation
     
 };
 
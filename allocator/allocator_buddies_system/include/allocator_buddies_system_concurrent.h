@@ -0,0 +1,153 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BUDDIES_SYSTEM_CONCURRENT_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BUDDIES_SYSTEM_CONCURRENT_H
+
+#include <atomic>
+#include <cstdint>
+#include <allocator_guardant.h>
+#include <allocator_test_utils.h>
+#include <allocator_with_fit_mode.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_buddies_system_concurrent final:
+    private allocator_guardant,
+    public allocator_test_utils,
+    public allocator_with_fit_mode,
+    private logger_guardant,
+    private typename_holder
+{
+
+private:
+    
+    struct order_state
+    {
+        
+        std::atomic<size_t> free_blocks_count;
+        
+        std::atomic<size_t> search_hint;
+        
+        std::atomic<uint64_t> *bitmap;
+        
+        size_t bitmap_words_count;
+        
+    };
+    
+    struct progress_state
+    {
+        
+        std::atomic<size_t> claimed_blocks_count;
+        
+        std::atomic<size_t> completed_operations_count;
+        
+        std::atomic<size_t> free_space_size;
+        
+    };
+
+private:
+    
+    void *_trusted_memory;
+
+public:
+    
+    ~allocator_buddies_system_concurrent() override;
+    
+    allocator_buddies_system_concurrent(
+        allocator_buddies_system_concurrent const &other) = delete;
+    
+    allocator_buddies_system_concurrent &operator=(
+        allocator_buddies_system_concurrent const &other) = delete;
+    
+    allocator_buddies_system_concurrent(
+        allocator_buddies_system_concurrent &&other) noexcept;
+    
+    allocator_buddies_system_concurrent &operator=(
+        allocator_buddies_system_concurrent &&other) noexcept;
+
+public:
+    
+    explicit allocator_buddies_system_concurrent(
+        size_t space_size_power_of_two,
+        allocator *parent_allocator = nullptr,
+        logger *logger = nullptr,
+        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+
+public:
+    
+    using allocator::allocate;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    void deallocate(
+        void *at) override;
+
+public:
+    
+    inline void set_fit_mode(
+        allocator_with_fit_mode::fit_mode mode) override;
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+public:
+    
+    std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t occupied_block_meta_size() noexcept;
+    
+    static constexpr unsigned char min_block_power() noexcept;
+    
+    inline progress_state &obtain_progress_state() const noexcept;
+    
+    inline std::atomic<allocator_with_fit_mode::fit_mode> &obtain_fit_mode() const noexcept;
+    
+    inline unsigned char obtain_space_power() const noexcept;
+    
+    inline order_state &obtain_order_state(
+        unsigned char power) const noexcept;
+    
+    inline unsigned char *obtain_first_block() const noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region bitmap manipulation
+    
+    bool try_claim_block(
+        unsigned char requested_power,
+        bool is_worst_fit,
+        unsigned char &power,
+        size_t &block_index) const noexcept;
+    
+    bool try_claim_any_block(
+        unsigned char power,
+        size_t &block_index) const noexcept;
+    
+    void publish_free_block(
+        unsigned char power,
+        size_t block_index) const noexcept;
+    
+    static inline bool is_block_free(
+        order_state const &state,
+        size_t block_index) noexcept;
+    
+    // endregion bitmap manipulation
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_BUDDIES_SYSTEM_CONCURRENT_H
\ No newline at end of file
@@ -1,80 +1,783 @@
-#include <not_implemented.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 
 #include "../include/allocator_buddies_system.h"
 
 allocator_buddies_system::~allocator_buddies_system()
 {
-    throw not_implemented("allocator_buddies_system::~allocator_buddies_system()", "your code should be here...");
-}
-
-allocator_buddies_system::allocator_buddies_system(
-    allocator_buddies_system const &other)
-{
-    throw not_implemented("allocator_buddies_system::allocator_buddies_system(allocator_buddies_system const &)", "your code should be here...");
-}
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
 
-allocator_buddies_system &allocator_buddies_system::operator=(
-    allocator_buddies_system const &other)
-{
-    throw not_implemented("allocator_buddies_system &allocator_buddies_system::operator=(allocator_buddies_system const &)", "your code should be here...");
+    debug_with_guard(get_typename() + "::~allocator_buddies_system() : called");
+    release_trusted_memory();
 }
 
 allocator_buddies_system::allocator_buddies_system(
-    allocator_buddies_system &&other) noexcept
+    allocator_buddies_system &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_buddies_system::allocator_buddies_system(allocator_buddies_system &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_buddies_system &allocator_buddies_system::operator=(
     allocator_buddies_system &&other) noexcept
 {
-    throw not_implemented("allocator_buddies_system &allocator_buddies_system::operator=(allocator_buddies_system &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_trusted_memory();
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
 }
 
 allocator_buddies_system::allocator_buddies_system(
-    size_t space_size,
+    size_t space_size_power_of_two,
     allocator *parent_allocator,
     logger *logger,
-    allocator_with_fit_mode::fit_mode allocate_fit_mode)
+    allocator_with_fit_mode::fit_mode allocate_fit_mode,
+    trusted_memory_backing const &backing,
+    allocator_growth_policy const &growth_policy)
 {
-    throw not_implemented("allocator_buddies_system::allocator_buddies_system(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size_power_of_two < min_block_power())
+    {
+        throw std::logic_error("space size is too small to store even a single block");
+    }
+
+    if (space_size_power_of_two >= std::numeric_limits<size_t>::digits - 1)
+    {
+        throw std::logic_error("space size is too large");
+    }
+
+    size_t const trusted_memory_size = meta_size() + (static_cast<size_t>(1) << space_size_power_of_two);
+    _trusted_memory = backing.allocate(trusted_memory_size, parent_allocator);
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<trusted_memory_backing *>(memory) = backing;
+    memory += sizeof(trusted_memory_backing);
+
+    *reinterpret_cast<allocator_growth_policy *>(memory) = growth_policy;
+    memory += sizeof(allocator_growth_policy);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<size_t *>(memory) = 1;
+    memory += sizeof(size_t);
+
+    obtain_statistics_counters().reset();
+    memory += sizeof(allocator_with_statistics::statistics_counters);
+
+    std::fill_n(reinterpret_cast<size_t *>(memory), std::numeric_limits<size_t>::digits, 0);
+    memory += sizeof(size_t) * std::numeric_limits<size_t>::digits;
+
+    *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(memory) = allocate_fit_mode;
+    memory += sizeof(allocator_with_fit_mode::fit_mode);
+
+    *memory = static_cast<unsigned char>(space_size_power_of_two);
+
+    push_free_block(obtain_first_block(), static_cast<unsigned char>(space_size_power_of_two));
+
+    debug_with_guard(get_typename() + "::allocator_buddies_system(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode, trusted_memory_backing const &, allocator_growth_policy const &) : "
+        + "allocator with 2^" + std::to_string(space_size_power_of_two) + " bytes of space constructed");
 }
 
 [[nodiscard]] void *allocator_buddies_system::allocate(
     size_t value_size,
     size_t values_count)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_buddies_system::allocate(size_t, size_t)", "your code should be here...");
+    return allocate(value_size, values_count, 1);
+}
+
+[[nodiscard]] void *allocator_buddies_system::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (!is_valid_alignment(alignment))
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : alignment " + std::to_string(alignment) + " is not a power of two");
+
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() - occupied_block_meta_size() * 2 - alignment) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    unsigned char requested_power = obtain_requested_power(value_size * values_count, alignment);
+    void *target_block = find_free_block(requested_power);
+
+    if (target_block == nullptr && try_grow(requested_power))
+    {
+        // the new segment may be aligned differently from the existing ones
+        requested_power = obtain_requested_power(value_size * values_count, alignment);
+        target_block = find_free_block(requested_power);
+    }
+
+    if (target_block == nullptr)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : can't allocate "
+            + std::to_string(value_size * values_count) + " bytes");
+
+        throw std::bad_alloc();
+    }
+
+    remove_free_block(target_block);
+
+    unsigned char target_block_power = obtain_block_power(target_block);
+    while (target_block_power > requested_power)
+    {
+        --target_block_power;
+        push_free_block(reinterpret_cast<unsigned char *>(target_block) + (static_cast<size_t>(1) << target_block_power), target_block_power);
+    }
+
+    set_block_header(target_block, true, target_block_power);
+    obtain_block_owner(target_block) = _trusted_memory;
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.allocations_count;
+    counters.bytes_in_use += static_cast<size_t>(1) << target_block_power;
+
+    auto *payload = reinterpret_cast<unsigned char *>(target_block) + occupied_block_meta_size();
+
+    if (reinterpret_cast<uintptr_t>(payload) % alignment != 0)
+    {
+        auto const payload_address = reinterpret_cast<uintptr_t>(payload) + occupied_block_meta_size();
+        payload += occupied_block_meta_size() + (alignment - payload_address % alignment) % alignment;
+
+        void *forwarding_header = payload - occupied_block_meta_size();
+        set_forwarding_header(forwarding_header, payload - reinterpret_cast<unsigned char *>(target_block));
+        obtain_block_owner(forwarding_header) = _trusted_memory;
+    }
+
+    return payload;
 }
 
 void allocator_buddies_system::deallocate(
     void *at)
 {
-    throw not_implemented("void allocator_buddies_system::deallocate(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+    void *block = reinterpret_cast<unsigned char *>(at) - occupied_block_meta_size();
+    unsigned char space_power;
+
+    if (obtain_owning_space_first_block(block, space_power) != nullptr && is_block_forwarding(block))
+    {
+        block = reinterpret_cast<unsigned char *>(at) - obtain_forwarding_offset(block);
+    }
+
+    void *space_first_block = obtain_owning_space_first_block(block, space_power);
+
+    if (space_first_block == nullptr
+        || !is_block_occupied(block) || obtain_block_owner(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    unsigned char block_power = obtain_block_power(block);
+    void *freed_block = block;
+    size_t const freed_size = static_cast<size_t>(1) << block_power;
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.deallocations_count;
+    counters.bytes_in_use -= freed_size;
+
+    while (block_power < space_power)
+    {
+        void *buddy = obtain_buddy(block, space_first_block);
+
+        if (is_block_occupied(buddy) || obtain_block_power(buddy) != block_power)
+        {
+            break;
+        }
+
+        remove_free_block(buddy);
+
+        if (buddy < block)
+        {
+            block = buddy;
+        }
+
+        ++block_power;
+        set_block_header(block, false, block_power);
+    }
+
+    push_free_block(block, block_power);
+
+    obtain_trusted_memory_backing().release_free_pages(reinterpret_cast<unsigned char *>(block) + free_block_meta_size(),
+        (static_cast<size_t>(1) << block_power) - free_block_meta_size(), freed_block, freed_size);
+
+    try_release_segment(block);
 }
 
 inline void allocator_buddies_system::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_buddies_system::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    obtain_fit_mode() = mode;
 }
 
 inline allocator *allocator_buddies_system::get_allocator() const
 {
-    throw not_implemented("inline allocator *allocator_buddies_system::get_allocator() const", "your code should be here...");
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+allocator_with_statistics::statistics allocator_buddies_system::get_statistics() const noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+
+    size_t const *free_blocks_counts = obtain_free_blocks_counts();
+    size_t largest_free_block_size = 0;
+
+    for (size_t power = std::numeric_limits<size_t>::digits; power-- > 0; )
+    {
+        if (free_blocks_counts[power] != 0)
+        {
+            largest_free_block_size = static_cast<size_t>(1) << power;
+            break;
+        }
+    }
+
+    size_t space_size = static_cast<size_t>(1) << obtain_space_power();
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        space_size += static_cast<size_t>(1) << obtain_segment_space_power(segment);
+    }
+
+    return collect_statistics(counters, space_size, largest_free_block_size);
+}
+
+void allocator_buddies_system::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
 }
 
 std::vector<allocator_test_utils::block_info> allocator_buddies_system::get_blocks_info() const noexcept
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_buddies_system::get_blocks_info() const noexcept", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> blocks_info;
+
+    for (auto const &segment_blocks_info: get_segments_blocks_info())
+    {
+        blocks_info.insert(blocks_info.end(), segment_blocks_info.begin(), segment_blocks_info.end());
+    }
+
+    return blocks_info;
+}
+
+std::vector<std::vector<allocator_test_utils::block_info>> allocator_buddies_system::get_segments_blocks_info() const noexcept
+{
+    std::vector<std::vector<allocator_test_utils::block_info>> segments_blocks_info;
+
+    for (auto const &segment_bounds: obtain_segments_bounds())
+    {
+        segments_blocks_info.emplace_back();
+
+        for (auto *block = reinterpret_cast<unsigned char *>(segment_bounds.first);
+             block < segment_bounds.second;
+             block += static_cast<size_t>(1) << obtain_block_power(block))
+        {
+            segments_blocks_info.back().push_back(
+                {
+                    static_cast<size_t>(1) << obtain_block_power(block),
+                    is_block_occupied(block)
+                });
+        }
+    }
+
+    return segments_blocks_info;
 }
 
 inline logger *allocator_buddies_system::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_buddies_system::get_logger() const", "your code should be here...");
+    return *reinterpret_cast<logger **>(_trusted_memory);
 }
 
 inline std::string allocator_buddies_system::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_buddies_system::get_typename() const noexcept", "your code should be here...");
-}
\ No newline at end of file
+    return "allocator_buddies_system";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_buddies_system::meta_size() noexcept
+{
+    return (sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(size_t) * std::numeric_limits<size_t>::digits + sizeof(allocator_with_fit_mode::fit_mode)
+        + sizeof(unsigned char) + alignof(std::max_align_t) - 1)
+        / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+constexpr size_t allocator_buddies_system::occupied_block_meta_size() noexcept
+{
+    return sizeof(block_pointer_t) * 2;
+}
+
+constexpr size_t allocator_buddies_system::free_block_meta_size() noexcept
+{
+    return sizeof(block_pointer_t) * 3;
+}
+
+constexpr unsigned char allocator_buddies_system::min_block_power() noexcept
+{
+    unsigned char power = 0;
+    while ((static_cast<size_t>(1) << power) < free_block_meta_size())
+    {
+        ++power;
+    }
+
+    return power;
+}
+
+constexpr size_t allocator_buddies_system::segment_meta_size() noexcept
+{
+    return (sizeof(void *) + sizeof(unsigned char) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+inline void *&allocator_buddies_system::obtain_first_free_block() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline allocator_with_fit_mode::fit_mode &allocator_buddies_system::obtain_fit_mode() const noexcept
+{
+    return *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(size_t) * std::numeric_limits<size_t>::digits);
+}
+
+inline unsigned char allocator_buddies_system::obtain_space_power() const noexcept
+{
+    return *(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(size_t) * std::numeric_limits<size_t>::digits + sizeof(allocator_with_fit_mode::fit_mode));
+}
+
+inline void *allocator_buddies_system::obtain_first_block() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size();
+}
+
+inline void *allocator_buddies_system::obtain_space_end() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_first_block()) + (static_cast<size_t>(1) << obtain_space_power());
+}
+
+inline trusted_memory_backing &allocator_buddies_system::obtain_trusted_memory_backing() const noexcept
+{
+    return *reinterpret_cast<trusted_memory_backing *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *));
+}
+
+inline allocator_growth_policy &allocator_buddies_system::obtain_growth_policy() const noexcept
+{
+    return *reinterpret_cast<allocator_growth_policy *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing));
+}
+
+inline void *&allocator_buddies_system::obtain_last_segment() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy));
+}
+
+inline size_t &allocator_buddies_system::obtain_segments_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy)
+        + sizeof(void *));
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_buddies_system::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy)
+        + sizeof(void *) + sizeof(size_t));
+}
+
+inline size_t *allocator_buddies_system::obtain_free_blocks_counts() const noexcept
+{
+    return reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(void *) + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy)
+        + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters));
+}
+
+void allocator_buddies_system::release_trusted_memory()
+{
+    trusted_memory_backing const backing = obtain_trusted_memory_backing();
+
+    for (void *segment = obtain_last_segment(); segment != nullptr;)
+    {
+        void *previous_segment = obtain_previous_segment(segment);
+        backing.deallocate(segment, segment_meta_size() + (static_cast<size_t>(1) << obtain_segment_space_power(segment)), get_allocator());
+        segment = previous_segment;
+    }
+
+    backing.deallocate(_trusted_memory, reinterpret_cast<unsigned char *>(obtain_space_end()) - reinterpret_cast<unsigned char *>(_trusted_memory), get_allocator());
+}
+
+inline bool allocator_buddies_system::is_block_occupied(
+    void *block) noexcept
+{
+    return (*reinterpret_cast<unsigned char *>(block) & 0x80) != 0;
+}
+
+inline unsigned char allocator_buddies_system::obtain_block_power(
+    void *block) noexcept
+{
+    return *reinterpret_cast<unsigned char *>(block) & 0x3F;
+}
+
+inline void allocator_buddies_system::set_block_header(
+    void *block,
+    bool is_occupied,
+    unsigned char power) noexcept
+{
+    *reinterpret_cast<unsigned char *>(block) = static_cast<unsigned char>((is_occupied ? 0x80 : 0x00) | power);
+}
+
+inline bool allocator_buddies_system::is_block_forwarding(
+    void *block) noexcept
+{
+    return (*reinterpret_cast<unsigned char *>(block) & 0x40) != 0;
+}
+
+inline size_t allocator_buddies_system::obtain_forwarding_offset(
+    void *block) noexcept
+{
+    return *reinterpret_cast<size_t *>(block) >> 8;
+}
+
+inline void allocator_buddies_system::set_forwarding_header(
+    void *header,
+    size_t offset) noexcept
+{
+    *reinterpret_cast<size_t *>(header) = (offset << 8) | 0xC0;
+}
+
+inline void *&allocator_buddies_system::obtain_previous_free_block(
+    void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(block) + sizeof(block_pointer_t));
+}
+
+inline void *&allocator_buddies_system::obtain_next_free_block(
+    void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(block) + sizeof(block_pointer_t) * 2);
+}
+
+inline allocator::block_pointer_t &allocator_buddies_system::obtain_block_owner(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_pointer_t *>(reinterpret_cast<unsigned char *>(block) + sizeof(block_pointer_t));
+}
+
+inline void *allocator_buddies_system::obtain_buddy(
+    void *block,
+    void *space_first_block) noexcept
+{
+    auto *first_block = reinterpret_cast<unsigned char *>(space_first_block);
+    size_t const block_offset = reinterpret_cast<unsigned char *>(block) - first_block;
+
+    return first_block + (block_offset ^ (static_cast<size_t>(1) << obtain_block_power(block)));
+}
+
+inline void *&allocator_buddies_system::obtain_previous_segment(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<void **>(segment);
+}
+
+inline unsigned char &allocator_buddies_system::obtain_segment_space_power(
+    void *segment) noexcept
+{
+    return *(reinterpret_cast<unsigned char *>(segment) + sizeof(void *));
+}
+
+inline void *allocator_buddies_system::obtain_segment_first_block(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(segment) + segment_meta_size();
+}
+
+inline void *allocator_buddies_system::obtain_segment_space_end(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_segment_first_block(segment)) + (static_cast<size_t>(1) << obtain_segment_space_power(segment));
+}
+
+// endregion trusted memory layout
+
+// region segments manipulation
+
+void *allocator_buddies_system::obtain_owning_space_first_block(
+    void *block,
+    unsigned char &space_power) const noexcept
+{
+    if (block >= obtain_first_block() && block < obtain_space_end())
+    {
+        space_power = obtain_space_power();
+
+        return obtain_first_block();
+    }
+
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        if (block >= obtain_segment_first_block(segment) && block < obtain_segment_space_end(segment))
+        {
+            space_power = obtain_segment_space_power(segment);
+
+            return obtain_segment_first_block(segment);
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<std::pair<void *, void *>> allocator_buddies_system::obtain_segments_bounds() const
+{
+    std::vector<std::pair<void *, void *>> segments_bounds { { obtain_first_block(), obtain_space_end() } };
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        segments_bounds.emplace(segments_bounds.begin() + 1, obtain_segment_first_block(segment), obtain_segment_space_end(segment));
+    }
+
+    return segments_bounds;
+}
+
+bool allocator_buddies_system::is_alignment_natural(
+    size_t alignment) const noexcept
+{
+    if ((reinterpret_cast<uintptr_t>(obtain_first_block()) + occupied_block_meta_size()) % alignment != 0)
+    {
+        return false;
+    }
+
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        if ((reinterpret_cast<uintptr_t>(obtain_segment_first_block(segment)) + occupied_block_meta_size()) % alignment != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool allocator_buddies_system::try_grow(
+    unsigned char requested_power)
+{
+    allocator_growth_policy const &growth_policy = obtain_growth_policy();
+
+    if (!growth_policy.can_grow(obtain_segments_count()) || requested_power >= std::numeric_limits<size_t>::digits - 1)
+    {
+        return false;
+    }
+
+    size_t const segment_size = growth_policy.obtain_segment_size(static_cast<size_t>(1) << obtain_space_power(), static_cast<size_t>(1) << requested_power);
+    unsigned char segment_power = requested_power;
+    while (segment_power < std::numeric_limits<size_t>::digits - 1 && (static_cast<size_t>(1) << segment_power) < segment_size)
+    {
+        ++segment_power;
+    }
+
+    if (segment_power >= std::numeric_limits<size_t>::digits - 1)
+    {
+        return false;
+    }
+
+    void *segment = obtain_trusted_memory_backing().allocate(segment_meta_size() + (static_cast<size_t>(1) << segment_power), get_allocator());
+
+    obtain_previous_segment(segment) = obtain_last_segment();
+    obtain_segment_space_power(segment) = segment_power;
+    obtain_last_segment() = segment;
+    ++obtain_segments_count();
+
+    push_free_block(obtain_segment_first_block(segment), segment_power);
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::allocate(size_t, size_t, size_t) : segment of 2^"
+            + std::to_string(segment_power) + " bytes allocated";
+    });
+
+    return true;
+}
+
+bool allocator_buddies_system::try_release_segment(
+    void *block) noexcept
+{
+    if (!obtain_growth_policy().is_releasing_empty_segments())
+    {
+        return false;
+    }
+
+    void *segment = reinterpret_cast<unsigned char *>(block) - segment_meta_size();
+    void *next_segment = nullptr;
+
+    for (void *current_segment = obtain_last_segment(); current_segment != segment; current_segment = obtain_previous_segment(current_segment))
+    {
+        if (current_segment == nullptr)
+        {
+            return false;
+        }
+
+        next_segment = current_segment;
+    }
+
+    if (is_block_occupied(block) || obtain_block_power(block) != obtain_segment_space_power(segment))
+    {
+        return false;
+    }
+
+    remove_free_block(block);
+
+    (next_segment == nullptr
+        ? obtain_last_segment()
+        : obtain_previous_segment(next_segment)) = obtain_previous_segment(segment);
+    --obtain_segments_count();
+
+    unsigned char const segment_power = obtain_segment_space_power(segment);
+    obtain_trusted_memory_backing().deallocate(segment, segment_meta_size() + (static_cast<size_t>(1) << segment_power), get_allocator());
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::deallocate(void *) : empty segment of 2^"
+            + std::to_string(segment_power) + " bytes released";
+    });
+
+    return true;
+}
+
+// endregion segments manipulation
+
+// region free list manipulation
+
+unsigned char allocator_buddies_system::obtain_requested_power(
+    size_t size,
+    size_t alignment) const noexcept
+{
+    bool const is_natural = is_alignment_natural(alignment);
+    size_t const requested_size = is_natural
+        ? size + occupied_block_meta_size()
+        : size + occupied_block_meta_size() * 2 + alignment;
+
+    unsigned char requested_power = min_block_power();
+    while (requested_power < std::numeric_limits<size_t>::digits - 1
+        && ((static_cast<size_t>(1) << requested_power) < requested_size
+            || (is_natural && (static_cast<size_t>(1) << requested_power) < alignment)))
+    {
+        ++requested_power;
+    }
+
+    return requested_power;
+}
+
+void *allocator_buddies_system::find_free_block(
+    unsigned char requested_power) const noexcept
+{
+    allocator_with_fit_mode::fit_mode const fit_mode = obtain_fit_mode();
+    void *target_block = nullptr;
+
+    for (void *current_block = obtain_first_free_block(); current_block != nullptr; current_block = obtain_next_free_block(current_block))
+    {
+        unsigned char const current_block_power = obtain_block_power(current_block);
+
+        if (current_block_power < requested_power)
+        {
+            continue;
+        }
+
+        if (target_block == nullptr
+            || (fit_mode == allocator_with_fit_mode::fit_mode::the_best_fit && current_block_power < obtain_block_power(target_block))
+            || (fit_mode == allocator_with_fit_mode::fit_mode::the_worst_fit && current_block_power > obtain_block_power(target_block)))
+        {
+            target_block = current_block;
+
+            if (fit_mode == allocator_with_fit_mode::fit_mode::first_fit)
+            {
+                break;
+            }
+        }
+    }
+
+    return target_block;
+}
+
+void allocator_buddies_system::push_free_block(
+    void *block,
+    unsigned char power) noexcept
+{
+    obtain_statistics_counters().on_free_block_appeared(static_cast<size_t>(1) << power);
+    ++obtain_free_blocks_counts()[power];
+
+    void *&first_free_block = obtain_first_free_block();
+
+    set_block_header(block, false, power);
+    obtain_previous_free_block(block) = nullptr;
+    obtain_next_free_block(block) = first_free_block;
+
+    if (first_free_block != nullptr)
+    {
+        obtain_previous_free_block(first_free_block) = block;
+    }
+
+    first_free_block = block;
+}
+
+void allocator_buddies_system::remove_free_block(
+    void *block) noexcept
+{
+    obtain_statistics_counters().on_free_block_disappeared(static_cast<size_t>(1) << obtain_block_power(block));
+    --obtain_free_blocks_counts()[obtain_block_power(block)];
+
+    void *previous_free_block = obtain_previous_free_block(block);
+    void *next_free_block = obtain_next_free_block(block);
+
+    (previous_free_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_next_free_block(previous_free_block)) = next_free_block;
+
+    if (next_free_block != nullptr)
+    {
+        obtain_previous_free_block(next_free_block) = previous_free_block;
+    }
+}
+
+// endregion free list manipulation
\ No newline at end of file
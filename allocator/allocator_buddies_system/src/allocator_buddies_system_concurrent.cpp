@@ -0,0 +1,479 @@
+#include <limits>
+#include <new>
+#include <thread>
+
+#include "../include/allocator_buddies_system_concurrent.h"
+
+allocator_buddies_system_concurrent::~allocator_buddies_system_concurrent()
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard(get_typename() + "::~allocator_buddies_system_concurrent() : called");
+    deallocate_with_guard(_trusted_memory);
+}
+
+allocator_buddies_system_concurrent::allocator_buddies_system_concurrent(
+    allocator_buddies_system_concurrent &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
+{
+    other._trusted_memory = nullptr;
+}
+
+allocator_buddies_system_concurrent &allocator_buddies_system_concurrent::operator=(
+    allocator_buddies_system_concurrent &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            deallocate_with_guard(_trusted_memory);
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
+}
+
+allocator_buddies_system_concurrent::allocator_buddies_system_concurrent(
+    size_t space_size_power_of_two,
+    allocator *parent_allocator,
+    logger *logger,
+    allocator_with_fit_mode::fit_mode allocate_fit_mode)
+{
+    if (space_size_power_of_two < min_block_power())
+    {
+        throw std::logic_error("space size is too small to store even a single block");
+    }
+
+    if (space_size_power_of_two >= std::numeric_limits<size_t>::digits - 1)
+    {
+        throw std::logic_error("space size is too large");
+    }
+
+    auto const space_power = static_cast<unsigned char>(space_size_power_of_two);
+    size_t const orders_count = space_power - min_block_power() + 1;
+
+    size_t bitmap_words_total_count = 0;
+    for (unsigned char power = min_block_power(); power <= space_power; ++power)
+    {
+        bitmap_words_total_count += ((static_cast<size_t>(1) << (space_power - power)) + 63) / 64;
+    }
+
+    size_t const blocks_offset = (meta_size() + orders_count * sizeof(order_state) + bitmap_words_total_count * sizeof(std::atomic<uint64_t>)
+        + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+    size_t const trusted_memory_size = blocks_offset + (static_cast<size_t>(1) << space_power);
+
+    _trusted_memory = parent_allocator == nullptr
+        ? ::operator new(trusted_memory_size)
+        : parent_allocator->allocate(1, trusted_memory_size);
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<unsigned char **>(memory) = reinterpret_cast<unsigned char *>(_trusted_memory) + blocks_offset;
+    memory += sizeof(unsigned char *);
+
+    auto *progress = new (memory) progress_state;
+    progress->claimed_blocks_count.store(0);
+    progress->completed_operations_count.store(0);
+    progress->free_space_size.store(static_cast<size_t>(1) << space_power);
+    memory += sizeof(progress_state);
+
+    new (memory) std::atomic<allocator_with_fit_mode::fit_mode>(allocate_fit_mode);
+    memory += sizeof(std::atomic<allocator_with_fit_mode::fit_mode>);
+
+    *memory = space_power;
+
+    auto *bitmap_word = reinterpret_cast<std::atomic<uint64_t> *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + meta_size() + orders_count * sizeof(order_state));
+
+    for (unsigned char power = min_block_power(); power <= space_power; ++power)
+    {
+        auto *state = new (&obtain_order_state(power)) order_state;
+        state->free_blocks_count.store(0);
+        state->search_hint.store(0);
+        state->bitmap = bitmap_word;
+        state->bitmap_words_count = ((static_cast<size_t>(1) << (space_power - power)) + 63) / 64;
+
+        for (size_t i = 0; i < state->bitmap_words_count; ++i)
+        {
+            new (bitmap_word++) std::atomic<uint64_t>(0);
+        }
+    }
+
+    obtain_order_state(space_power).free_blocks_count.store(1);
+    obtain_order_state(space_power).bitmap[0].store(1);
+
+    debug_with_guard(get_typename() + "::allocator_buddies_system_concurrent(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode) : "
+        + "allocator with 2^" + std::to_string(space_size_power_of_two) + " bytes of space constructed");
+}
+
+[[nodiscard]] void *allocator_buddies_system_concurrent::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() - occupied_block_meta_size()) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_size = value_size * values_count + occupied_block_meta_size();
+    unsigned char const space_power = obtain_space_power();
+
+    unsigned char requested_power = min_block_power();
+    while (requested_power <= space_power && (static_cast<size_t>(1) << requested_power) < requested_size)
+    {
+        ++requested_power;
+    }
+
+    if (requested_power > space_power)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t) : can't allocate "
+            + std::to_string(requested_size) + " bytes");
+
+        throw std::bad_alloc();
+    }
+
+    bool const is_worst_fit = obtain_fit_mode().load(std::memory_order_relaxed) == allocator_with_fit_mode::fit_mode::the_worst_fit;
+    progress_state &progress = obtain_progress_state();
+    unsigned char power;
+    size_t block_index;
+
+    while (true)
+    {
+        size_t const completed_operations_count = progress.completed_operations_count.load();
+
+        if (try_claim_block(requested_power, is_worst_fit, power, block_index))
+        {
+            break;
+        }
+
+        // blocks being split or coalesced by other threads are absent from every bitmap, so the miss is final
+        // only if nothing was in flight and nothing completed while the bitmaps were scanned
+        if (progress.free_space_size.load() < (static_cast<size_t>(1) << requested_power)
+            || (progress.claimed_blocks_count.load() == 0
+                && progress.completed_operations_count.load() == completed_operations_count))
+        {
+            error_with_guard(get_typename() + "::allocate(size_t, size_t) : can't allocate "
+                + std::to_string(requested_size) + " bytes");
+
+            throw std::bad_alloc();
+        }
+
+        std::this_thread::yield();
+    }
+
+    while (power > requested_power)
+    {
+        --power;
+        block_index <<= 1;
+        publish_free_block(power, block_index + 1);
+    }
+
+    progress.free_space_size.fetch_sub(static_cast<size_t>(1) << requested_power);
+    progress.completed_operations_count.fetch_add(1);
+    progress.claimed_blocks_count.fetch_sub(1);
+
+    unsigned char *block = obtain_first_block() + (block_index << power);
+    *block = static_cast<unsigned char>(0x80 | power);
+    *reinterpret_cast<block_pointer_t *>(block + sizeof(block_pointer_t)) = _trusted_memory;
+
+    return block + occupied_block_meta_size();
+}
+
+void allocator_buddies_system_concurrent::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    unsigned char *block = reinterpret_cast<unsigned char *>(at) - occupied_block_meta_size();
+    unsigned char *first_block = obtain_first_block();
+
+    if (block < first_block || block >= first_block + (static_cast<size_t>(1) << obtain_space_power())
+        || (*block & 0x80) == 0 || *reinterpret_cast<block_pointer_t *>(block + sizeof(block_pointer_t)) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    auto const power = static_cast<unsigned char>(*block & 0x7F);
+    *block = power;
+
+    progress_state &progress = obtain_progress_state();
+    progress.claimed_blocks_count.fetch_add(1);
+    progress.free_space_size.fetch_add(static_cast<size_t>(1) << power);
+
+    publish_free_block(power, static_cast<size_t>(block - first_block) >> power);
+
+    progress.completed_operations_count.fetch_add(1);
+    progress.claimed_blocks_count.fetch_sub(1);
+}
+
+inline void allocator_buddies_system_concurrent::set_fit_mode(
+    allocator_with_fit_mode::fit_mode mode)
+{
+    obtain_fit_mode().store(mode, std::memory_order_relaxed);
+}
+
+inline allocator *allocator_buddies_system_concurrent::get_allocator() const
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+std::vector<allocator_test_utils::block_info> allocator_buddies_system_concurrent::get_blocks_info() const noexcept
+{
+    std::vector<allocator_test_utils::block_info> blocks_info;
+
+    unsigned char const space_power = obtain_space_power();
+    size_t const space_size = static_cast<size_t>(1) << space_power;
+
+    for (size_t offset = 0; offset < space_size;)
+    {
+        unsigned char power = space_power;
+        bool is_free = false;
+
+        for (;; --power)
+        {
+            if ((offset & ((static_cast<size_t>(1) << power) - 1)) == 0
+                && is_block_free(obtain_order_state(power), offset >> power))
+            {
+                is_free = true;
+                break;
+            }
+
+            if (power == min_block_power())
+            {
+                break;
+            }
+        }
+
+        if (!is_free)
+        {
+            power = *(obtain_first_block() + offset) & 0x7F;
+        }
+
+        blocks_info.push_back(
+            {
+                static_cast<size_t>(1) << power,
+                !is_free
+            });
+
+        offset += static_cast<size_t>(1) << power;
+    }
+
+    return blocks_info;
+}
+
+inline logger *allocator_buddies_system_concurrent::get_logger() const
+{
+    return *reinterpret_cast<logger **>(_trusted_memory);
+}
+
+inline std::string allocator_buddies_system_concurrent::get_typename() const noexcept
+{
+    return "allocator_buddies_system_concurrent";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_buddies_system_concurrent::meta_size() noexcept
+{
+    return (sizeof(logger *) + sizeof(allocator *) + sizeof(unsigned char *) + sizeof(progress_state) + sizeof(std::atomic<allocator_with_fit_mode::fit_mode>)
+        + sizeof(unsigned char) + alignof(std::max_align_t) - 1)
+        / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+constexpr size_t allocator_buddies_system_concurrent::occupied_block_meta_size() noexcept
+{
+    return sizeof(block_pointer_t) * 2;
+}
+
+constexpr unsigned char allocator_buddies_system_concurrent::min_block_power() noexcept
+{
+    unsigned char power = 0;
+    while ((static_cast<size_t>(1) << power) < occupied_block_meta_size())
+    {
+        ++power;
+    }
+
+    return power;
+}
+
+inline allocator_buddies_system_concurrent::progress_state &allocator_buddies_system_concurrent::obtain_progress_state() const noexcept
+{
+    return *reinterpret_cast<progress_state *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(unsigned char *));
+}
+
+inline std::atomic<allocator_with_fit_mode::fit_mode> &allocator_buddies_system_concurrent::obtain_fit_mode() const noexcept
+{
+    return *reinterpret_cast<std::atomic<allocator_with_fit_mode::fit_mode> *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(unsigned char *) + sizeof(progress_state));
+}
+
+inline unsigned char allocator_buddies_system_concurrent::obtain_space_power() const noexcept
+{
+    return *(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(unsigned char *) + sizeof(progress_state) + sizeof(std::atomic<allocator_with_fit_mode::fit_mode>));
+}
+
+inline allocator_buddies_system_concurrent::order_state &allocator_buddies_system_concurrent::obtain_order_state(
+    unsigned char power) const noexcept
+{
+    return reinterpret_cast<order_state *>(reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size())[power - min_block_power()];
+}
+
+inline unsigned char *allocator_buddies_system_concurrent::obtain_first_block() const noexcept
+{
+    return *reinterpret_cast<unsigned char **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+// endregion trusted memory layout
+
+// region bitmap manipulation
+
+bool allocator_buddies_system_concurrent::try_claim_block(
+    unsigned char requested_power,
+    bool is_worst_fit,
+    unsigned char &power,
+    size_t &block_index) const noexcept
+{
+    unsigned char const space_power = obtain_space_power();
+
+    for (unsigned char i = 0; i <= space_power - requested_power; ++i)
+    {
+        power = is_worst_fit
+            ? space_power - i
+            : requested_power + i;
+
+        if (try_claim_any_block(power, block_index))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool allocator_buddies_system_concurrent::try_claim_any_block(
+    unsigned char power,
+    size_t &block_index) const noexcept
+{
+    order_state &state = obtain_order_state(power);
+    std::atomic<size_t> &claimed_blocks_count = obtain_progress_state().claimed_blocks_count;
+
+    if (state.free_blocks_count.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+
+    size_t const first_word_index = state.search_hint.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < state.bitmap_words_count; ++i)
+    {
+        size_t const word_index = (first_word_index + i) % state.bitmap_words_count;
+        std::atomic<uint64_t> &word = state.bitmap[word_index];
+        uint64_t expected = word.load(std::memory_order_acquire);
+
+        if (expected == 0)
+        {
+            continue;
+        }
+
+        claimed_blocks_count.fetch_add(1);
+
+        while (expected != 0)
+        {
+            int const bit_index = __builtin_ctzll(expected);
+
+            if (word.compare_exchange_weak(expected, expected & ~(static_cast<uint64_t>(1) << bit_index),
+                std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                state.free_blocks_count.fetch_sub(1, std::memory_order_relaxed);
+                state.search_hint.store(word_index, std::memory_order_relaxed);
+                block_index = word_index * 64 + bit_index;
+
+                return true;
+            }
+        }
+
+        claimed_blocks_count.fetch_sub(1);
+    }
+
+    return false;
+}
+
+void allocator_buddies_system_concurrent::publish_free_block(
+    unsigned char power,
+    size_t block_index) const noexcept
+{
+    unsigned char const space_power = obtain_space_power();
+
+    while (true)
+    {
+        order_state &state = obtain_order_state(power);
+        std::atomic<uint64_t> &word = state.bitmap[block_index / 64];
+        uint64_t const own_bit = static_cast<uint64_t>(1) << (block_index % 64);
+        uint64_t const buddy_bit = power == space_power
+            ? 0
+            : static_cast<uint64_t>(1) << ((block_index ^ 1) % 64);
+
+        state.free_blocks_count.fetch_add(1, std::memory_order_acq_rel);
+
+        uint64_t expected = word.load(std::memory_order_acquire);
+        bool is_buddy_claimed = false;
+
+        while (true)
+        {
+            if ((expected & buddy_bit) != 0)
+            {
+                if (word.compare_exchange_weak(expected, expected & ~buddy_bit,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    is_buddy_claimed = true;
+                    break;
+                }
+            }
+            else if (word.compare_exchange_weak(expected, expected | own_bit,
+                std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        if (!is_buddy_claimed)
+        {
+            return;
+        }
+
+        state.free_blocks_count.fetch_sub(2, std::memory_order_relaxed);
+        block_index >>= 1;
+        ++power;
+    }
+}
+
+inline bool allocator_buddies_system_concurrent::is_block_free(
+    order_state const &state,
+    size_t block_index) noexcept
+{
+    return (state.bitmap[block_index / 64].load(std::memory_order_acquire) & (static_cast<uint64_t>(1) << (block_index % 64))) != 0;
+}
+
+// endregion bitmap manipulation
\ No newline at end of file
@@ -1,10 +1,13 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <cmath>
 #include <allocator.h>
 #include <allocator_buddies_system.h>
+#include <allocator_buddies_system_concurrent.h>
 #include <client_logger_builder.h>
 #include <logger.h>
 #include <logger_builder.h>
+#include <thread>
 
 logger *create_logger(
     std::vector<std::pair<std::string, logger::severity>> const &output_file_streams_setup,
@@ -110,6 +113,290 @@ TEST(positiveTests, test3)
     delete allocator_instance;
 }
 
+TEST(positiveTests, test4)
+{
+    allocator *allocator_instance = new allocator_buddies_system(8, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 40);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    allocator_instance->deallocate(first_block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    std::vector<allocator_test_utils::block_info> expected_blocks_state
+        {
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = true }
+        };
+    
+    ASSERT_EQ(actual_blocks_state.size(), expected_blocks_state.size());
+    for (size_t i = 0; i < actual_blocks_state.size(); i++)
+    {
+        ASSERT_EQ(actual_blocks_state[i], expected_blocks_state[i]);
+    }
+    
+    allocator_instance->deallocate(second_block);
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 256);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test5)
+{
+    allocator *allocator_instance = new allocator_buddies_system(24, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing(trusted_memory_backing::kind::transparent_huge_pages, 1 << 16));
+    
+    auto *block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    std::fill(block, block + (1 << 23), 0xAB);
+    allocator_instance->deallocate(block);
+    
+    block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    
+    ASSERT_EQ(block[1 << 22], 0);
+    
+    allocator_instance->deallocate(block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test6)
+{
+    allocator *allocator_instance = new allocator_buddies_system(16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 100, alignment);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignment, 0);
+        
+        std::fill(reinterpret_cast<unsigned char *>(block), reinterpret_cast<unsigned char *>(block) + 100, 0xCD);
+        blocks.push_back(block);
+    }
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 100, 48)), std::logic_error);
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test7)
+{
+    allocator *allocator_instance = new allocator_buddies_system(10, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit,
+        trusted_memory_backing(), allocator_growth_policy(4096, 3));
+    auto *allocator_test_utils_instance = dynamic_cast<allocator_test_utils *>(allocator_instance);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 2000);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 1500);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 8000);
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 8000)), std::bad_alloc);
+    
+    auto segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 3);
+    ASSERT_EQ(segments_blocks_info[0].size(), 1);
+    ASSERT_FALSE(segments_blocks_info[0][0].is_block_occupied);
+    ASSERT_EQ(segments_blocks_info[1].size(), 2);
+    ASSERT_EQ(segments_blocks_info[2].size(), 1);
+    ASSERT_EQ(segments_blocks_info[2][0].block_size, 8192);
+    
+    auto statistics = dynamic_cast<allocator_with_statistics *>(allocator_instance)->get_statistics();
+    
+    ASSERT_EQ(statistics.bytes_in_use + statistics.bytes_free, 1024 + 4096 + 8192);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(third_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 2);
+    ASSERT_EQ(segments_blocks_info[1].size(), 2);
+    
+    allocator_instance->deallocate(second_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 1);
+    ASSERT_EQ(allocator_test_utils_instance->get_blocks_info(), segments_blocks_info[0]);
+    
+    delete allocator_instance;
+}
+
+TEST(concurrentPositiveTests, test1)
+{
+    allocator *allocator_instance = new allocator_buddies_system_concurrent(8, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 40);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    std::vector<allocator_test_utils::block_info> expected_blocks_state
+        {
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = false }
+        };
+    
+    ASSERT_EQ(actual_blocks_state.size(), expected_blocks_state.size());
+    for (size_t i = 0; i < actual_blocks_state.size(); i++)
+    {
+        ASSERT_EQ(actual_blocks_state[i], expected_blocks_state[i]);
+    }
+    
+    allocator_instance->deallocate(first_block);
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 256);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+    
+    delete allocator_instance;
+}
+
+TEST(concurrentPositiveTests, test2)
+{
+    allocator *allocator_instance = new allocator_buddies_system_concurrent(22, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit);
+    
+    int const threads_count = 8;
+    int const iterations_count = 5000;
+    std::vector<std::thread> threads;
+    
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back([allocator_instance, i]()
+        {
+            std::vector<std::pair<unsigned char *, size_t>> blocks;
+            
+            for (int j = 0; j < iterations_count; j++)
+            {
+                size_t const size = static_cast<size_t>(1) << ((i + j) % 10);
+                auto *block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), size));
+                std::fill(block, block + size, static_cast<unsigned char>(i));
+                blocks.emplace_back(block, size);
+                
+                if (j % 4 == 3)
+                {
+                    for (auto &allocated_block: blocks)
+                    {
+                        ASSERT_EQ(allocated_block.first[allocated_block.second - 1], static_cast<unsigned char>(i));
+                        allocator_instance->deallocate(allocated_block.first);
+                    }
+                    
+                    blocks.clear();
+                }
+            }
+            
+            for (auto &allocated_block: blocks)
+            {
+                allocator_instance->deallocate(allocated_block.first);
+            }
+        });
+    }
+    
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 1 << 22);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+    
+    delete allocator_instance;
+}
+
+TEST(concurrentPositiveTests, test3)
+{
+    int const rounds_count = 50;
+    int const threads_count = 8;
+    int const iterations_count = 2000;
+    
+    for (int round = 0; round < rounds_count; round++)
+    {
+        allocator *allocator_instance = new allocator_buddies_system_concurrent(16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+        std::atomic<int> failures_count(0);
+        std::vector<std::thread> threads;
+        
+        for (int i = 0; i < threads_count; i++)
+        {
+            threads.emplace_back([allocator_instance, i, &failures_count]()
+            {
+                std::vector<void *> blocks;
+                
+                for (int j = 0; j < iterations_count; j++)
+                {
+                    try
+                    {
+                        blocks.push_back(allocator_instance->allocate(sizeof(unsigned char), static_cast<size_t>(1) << ((i + j) % 10)));
+                    }
+                    catch (std::bad_alloc const &)
+                    {
+                        ++failures_count;
+                    }
+                    
+                    if (j % 4 == 3)
+                    {
+                        for (auto *block: blocks)
+                        {
+                            allocator_instance->deallocate(block);
+                        }
+                        
+                        blocks.clear();
+                    }
+                }
+                
+                for (auto *block: blocks)
+                {
+                    allocator_instance->deallocate(block);
+                }
+            });
+        }
+        
+        for (auto &thread: threads)
+        {
+            thread.join();
+        }
+        
+        // at most 32 blocks of up to 1024 bytes are alive at once, so a 64 KiB arena can always satisfy every request
+        ASSERT_EQ(failures_count.load(), 0);
+        
+        auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+        ASSERT_EQ(actual_blocks_state.size(), 1);
+        ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+        
+        delete allocator_instance;
+    }
+}
+
+TEST(concurrentNegativeTests, test1)
+{
+    allocator_buddies_system_concurrent allocator_instance(8);
+    
+    void *block = allocator_instance.allocate(sizeof(unsigned char), 200);
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance.allocate(sizeof(unsigned char), 1)), std::bad_alloc);
+    
+    allocator_instance.deallocate(block);
+}
+
 TEST(falsePositiveTests, test1)
 {
     ASSERT_THROW(new allocator_buddies_system(static_cast<int>(std::floor(std::log2(sizeof(allocator::block_pointer_t) * 2 + 1))) - 1), std::logic_error);
@@ -41,6 +41,11 @@ public:
         size_t value_size,
         size_t values_count) override;
     
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
     void deallocate(
         void *at) override;
 
@@ -57,8 +62,16 @@ private:
     
     inline std::string get_typename() const noexcept override;
 
-public:
-
+private:
+    
+    static constexpr size_t block_meta_size() noexcept;
+    
+    static inline void *&obtain_raw_memory(
+        void *at) noexcept;
+    
+    static inline block_size_t &obtain_block_size(
+        void *at) noexcept;
+    
 };
 
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_GLOBAL_HEAP_H
\ No newline at end of file
@@ -1,49 +1,127 @@
-#include <not_implemented.h>
+#include <cstdint>
+#include <limits>
+#include <new>
 
 #include "../include/allocator_global_heap.h"
 
 allocator_global_heap::allocator_global_heap(
-    logger *logger)
+    logger *logger):
+    _logger(logger)
 {
-    throw not_implemented("allocator_global_heap::allocator_global_heap(logger *)", "your code should be here...");
+    debug_with_guard(get_typename() + "::allocator_global_heap(logger *) : allocator constructed");
 }
 
 allocator_global_heap::~allocator_global_heap()
 {
-    throw not_implemented("allocator_global_heap::~allocator_global_heap()", "your code should be here...");
+    debug_with_guard(get_typename() + "::~allocator_global_heap() : called");
 }
 
 allocator_global_heap::allocator_global_heap(
-    allocator_global_heap &&other) noexcept
+    allocator_global_heap &&other) noexcept:
+    _logger(other._logger)
 {
-    throw not_implemented("allocator_global_heap::allocator_global_heap(allocator_global_heap &&) noexcept", "your code should be here...");
+    other._logger = nullptr;
 }
 
 allocator_global_heap &allocator_global_heap::operator=(
     allocator_global_heap &&other) noexcept
 {
-    throw not_implemented("allocator_global_heap &allocator_global_heap::operator=(allocator_global_heap &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        _logger = other._logger;
+        other._logger = nullptr;
+    }
+
+    return *this;
 }
 
 [[nodiscard]] void *allocator_global_heap::allocate(
     size_t value_size,
     size_t values_count)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_global_heap::allocate(size_t, size_t)", "your code should be here...");
+    return allocate(value_size, values_count, 1);
+}
+
+[[nodiscard]] void *allocator_global_heap::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    if (!is_valid_alignment(alignment))
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : alignment " + std::to_string(alignment) + " is not a power of two");
+
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    size_t const alignment_padding = alignment > alignof(std::max_align_t)
+        ? alignment - 1
+        : 0;
+
+    if (values_count != 0 && value_size > (std::numeric_limits<block_size_t>::max() - block_meta_size() - alignment_padding) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    block_size_t const requested_size = value_size * values_count;
+    void *raw_memory;
+
+    try
+    {
+        raw_memory = ::operator new(block_meta_size() + alignment_padding + requested_size);
+    }
+    catch (std::bad_alloc const &)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : can't allocate "
+            + std::to_string(requested_size) + " bytes");
+
+        throw;
+    }
+
+    auto const payload_address = reinterpret_cast<uintptr_t>(raw_memory) + block_meta_size();
+    void *at = reinterpret_cast<unsigned char *>(raw_memory) + block_meta_size() + (alignment - payload_address % alignment) % alignment;
+    obtain_raw_memory(at) = raw_memory;
+    obtain_block_size(at) = requested_size;
+
+    return at;
 }
 
 void allocator_global_heap::deallocate(
     void *at)
 {
-    throw not_implemented("void allocator_global_heap::deallocate(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    ::operator delete(obtain_raw_memory(at));
 }
 
 inline logger *allocator_global_heap::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_global_heap::get_logger() const", "your code should be here...");
+    return _logger;
 }
 
 inline std::string allocator_global_heap::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_global_heap::get_typename() const noexcept", "your code should be here...");
+    return "allocator_global_heap";
+}
+
+constexpr size_t allocator_global_heap::block_meta_size() noexcept
+{
+    return (sizeof(void *) + sizeof(block_size_t) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+inline void *&allocator_global_heap::obtain_raw_memory(
+    void *at) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(at) - sizeof(block_size_t) - sizeof(void *));
+}
+
+inline allocator::block_size_t &allocator_global_heap::obtain_block_size(
+    void *at) noexcept
+{
+    return *reinterpret_cast<block_size_t *>(reinterpret_cast<unsigned char *>(at) - sizeof(block_size_t));
 }
\ No newline at end of file
@@ -120,6 +120,55 @@ TEST(allocatorGlobalHeapTests, test5)
     delete allocator_instance;
 }
 
+TEST(allocatorGlobalHeapTests, test6)
+{
+    allocator *allocator_instance = new allocator_global_heap;
+    
+    auto *block = reinterpret_cast<int *>(allocator_instance->allocate(sizeof(int), 10));
+    for (int i = 0; i < 10; ++i)
+    {
+        block[i] = i;
+    }
+    
+    ASSERT_FALSE(allocator_instance->try_expand_in_place(block, sizeof(int), 20));
+    
+    block = reinterpret_cast<int *>(allocator_instance->reallocate(block, sizeof(int), 10, 20));
+    
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(block[i], i);
+    }
+    
+    allocator_instance->deallocate(block);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorGlobalHeapTests, test7)
+{
+    allocator *allocator_instance = new allocator_global_heap;
+    
+    std::vector<void *> blocks;
+    for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 100, alignment);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignment, 0);
+        
+        std::fill(reinterpret_cast<unsigned char *>(block), reinterpret_cast<unsigned char *>(block) + 100, 0xCD);
+        blocks.push_back(block);
+    }
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 100, 48)), std::logic_error);
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    delete allocator_instance;
+}
+
 class A final
 {
 
@@ -0,0 +1,107 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_NUMA_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_NUMA_H
+
+#include <functional>
+#include <memory>
+#include <allocator_guardant.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_numa final:
+    private allocator_guardant,
+    public allocator,
+    private logger_guardant,
+    private typename_holder
+{
+
+public:
+    
+    // blocks are routed back to their arena by the node memory mappings they lie in, so an arena must take
+    // its space from node_memory while being constructed; arenas that do not are rejected by the constructor
+    using arena_factory = std::function<allocator *(allocator *node_memory)>;
+
+private:
+    
+    class node_memory;
+    
+    struct node_arena;
+    
+    struct shared_state;
+
+private:
+    
+    std::unique_ptr<shared_state> _state;
+
+public:
+    
+    explicit allocator_numa(
+        arena_factory const &create_arena,
+        logger *logger = nullptr);
+    
+    ~allocator_numa() override;
+    
+    allocator_numa(
+        allocator_numa const &other) = delete;
+    
+    allocator_numa &operator=(
+        allocator_numa const &other) = delete;
+    
+    allocator_numa(
+        allocator_numa &&other) noexcept;
+    
+    allocator_numa &operator=(
+        allocator_numa &&other) noexcept;
+
+public:
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
+    void deallocate(
+        void *at) override;
+    
+    bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count) override;
+
+public:
+    
+    size_t get_nodes_count() const noexcept;
+    
+    size_t get_current_node() const noexcept;
+    
+    size_t get_owning_node(
+        void *at) const;
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    template<
+        typename F>
+    void *allocate_on_nodes(
+        F const &allocate_on_arena);
+    
+    node_arena *find_owning_arena(
+        void *at) const;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_NUMA_H
\ No newline at end of file
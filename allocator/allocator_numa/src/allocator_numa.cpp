@@ -0,0 +1,460 @@
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sched.h>
+#include <shared_mutex>
+#include <sstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../include/allocator_numa.h"
+
+class allocator_numa::node_memory final:
+    public allocator
+{
+
+private:
+
+    shared_state &_state;
+
+    size_t _node;
+
+    size_t _system_node_id;
+
+public:
+
+    node_memory(
+        shared_state &state,
+        size_t node,
+        size_t system_node_id) noexcept;
+
+public:
+
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+
+    void deallocate(
+        void *at) override;
+
+private:
+
+    void bind_to_node(
+        void *mapping,
+        size_t size) const noexcept;
+
+};
+
+struct allocator_numa::node_arena
+{
+
+    size_t node;
+
+    std::unique_ptr<node_memory> memory;
+
+    std::unique_ptr<allocator> arena;
+
+    std::mutex mutex;
+
+};
+
+struct allocator_numa::shared_state
+{
+
+    logger *target_logger;
+
+    bool is_binding_enabled;
+
+    std::vector<size_t> nodes_by_cpu;
+
+    mutable std::shared_timed_mutex ranges_mutex;
+
+    std::map<uintptr_t, std::pair<uintptr_t, size_t>> ranges;
+
+    std::vector<std::unique_ptr<node_arena>> arenas;
+
+    static std::vector<size_t> read_indices_list(
+        std::string const &path)
+    {
+        std::ifstream stream(path);
+        std::string list;
+        std::vector<size_t> indices;
+
+        if (!std::getline(stream, list))
+        {
+            return indices;
+        }
+
+        std::istringstream list_stream(list);
+
+        for (std::string range; std::getline(list_stream, range, ',');)
+        {
+            size_t const separator = range.find('-');
+
+            try
+            {
+                size_t const first = std::stoul(range.substr(0, separator));
+                size_t const last = separator == std::string::npos
+                    ? first
+                    : std::stoul(range.substr(separator + 1));
+
+                for (size_t index = first; index <= last; ++index)
+                {
+                    indices.push_back(index);
+                }
+            }
+            catch (std::invalid_argument const &)
+            {
+                return std::vector<size_t>();
+            }
+        }
+
+        return indices;
+    }
+
+};
+
+allocator_numa::node_memory::node_memory(
+    shared_state &state,
+    size_t node,
+    size_t system_node_id) noexcept:
+    _state(state),
+    _node(node),
+    _system_node_id(system_node_id)
+{
+
+}
+
+void *allocator_numa::node_memory::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    static size_t const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() - page_size) / values_count)
+    {
+        throw std::bad_alloc();
+    }
+
+    size_t const size = (value_size * values_count + page_size - 1) / page_size * page_size;
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    bind_to_node(mapping, size);
+
+    try
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(_state.ranges_mutex);
+        auto const begin = reinterpret_cast<uintptr_t>(mapping);
+        _state.ranges.emplace(begin, std::make_pair(begin + size, _node));
+    }
+    catch (...)
+    {
+        munmap(mapping, size);
+
+        throw;
+    }
+
+    return mapping;
+}
+
+void allocator_numa::node_memory::deallocate(
+    void *at)
+{
+    uintptr_t end;
+
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(_state.ranges_mutex);
+        auto range = _state.ranges.find(reinterpret_cast<uintptr_t>(at));
+
+        if (range == _state.ranges.end() || range->second.second != _node)
+        {
+            throw std::logic_error("attempt to deallocate memory not mapped for node");
+        }
+
+        end = range->second.first;
+        _state.ranges.erase(range);
+    }
+
+    munmap(at, end - reinterpret_cast<uintptr_t>(at));
+}
+
+void allocator_numa::node_memory::bind_to_node(
+    void *mapping,
+    size_t size) const noexcept
+{
+#ifdef SYS_mbind
+    if (!_state.is_binding_enabled)
+    {
+        return;
+    }
+
+    constexpr int preferred_policy = 1;
+    constexpr size_t mask_word_bits = sizeof(unsigned long) * CHAR_BIT;
+
+    std::vector<unsigned long> node_mask(_system_node_id / mask_word_bits + 1, 0);
+    node_mask[_system_node_id / mask_word_bits] |= 1UL << (_system_node_id % mask_word_bits);
+
+    syscall(SYS_mbind, mapping, size, preferred_policy, node_mask.data(), node_mask.size() * mask_word_bits + 1, 0);
+#endif
+}
+
+allocator_numa::allocator_numa(
+    arena_factory const &create_arena,
+    logger *logger):
+    _state(new shared_state)
+{
+    _state->target_logger = logger;
+
+    std::vector<size_t> system_node_ids = shared_state::read_indices_list("/sys/devices/system/node/online");
+
+    if (system_node_ids.empty())
+    {
+        system_node_ids.push_back(0);
+    }
+
+    _state->is_binding_enabled = system_node_ids.size() > 1;
+
+    for (size_t node = 0; node < system_node_ids.size(); ++node)
+    {
+        std::vector<size_t> const cpus = shared_state::read_indices_list(
+            "/sys/devices/system/node/node" + std::to_string(system_node_ids[node]) + "/cpulist");
+
+        for (size_t cpu: cpus)
+        {
+            if (cpu >= _state->nodes_by_cpu.size())
+            {
+                _state->nodes_by_cpu.resize(cpu + 1, 0);
+            }
+
+            _state->nodes_by_cpu[cpu] = node;
+        }
+
+        std::unique_ptr<node_arena> arena(new node_arena);
+        arena->node = node;
+        arena->memory.reset(new node_memory(*_state, node, system_node_ids[node]));
+        arena->arena.reset(create_arena(arena->memory.get()));
+
+        if (arena->arena == nullptr)
+        {
+            error_with_guard(get_typename() + "::allocator_numa(allocator_numa::arena_factory const &, logger *) : arena factory returned no allocator for node "
+                + std::to_string(system_node_ids[node]));
+
+            throw std::logic_error("arena factory returned no allocator");
+        }
+
+        bool is_arena_drawing_from_node;
+
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(_state->ranges_mutex);
+            is_arena_drawing_from_node = std::any_of(_state->ranges.begin(), _state->ranges.end(), [node](std::pair<uintptr_t const, std::pair<uintptr_t, size_t>> const &range)
+            {
+                return range.second.second == node;
+            });
+        }
+
+        if (!is_arena_drawing_from_node)
+        {
+            error_with_guard(get_typename() + "::allocator_numa(allocator_numa::arena_factory const &, logger *) : arena of node "
+                + std::to_string(system_node_ids[node]) + " does not draw its memory from the node memory");
+
+            throw std::logic_error("arena does not draw its memory from the node memory");
+        }
+
+        _state->arenas.push_back(std::move(arena));
+    }
+
+    debug_with_guard(get_typename() + "::allocator_numa(allocator_numa::arena_factory const &, logger *) : "
+        + std::to_string(_state->arenas.size()) + " node arenas constructed"
+        + (_state->is_binding_enabled
+            ? ""
+            : ", memory binding disabled"));
+}
+
+allocator_numa::~allocator_numa()
+{
+    if (_state == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard(get_typename() + "::~allocator_numa() : called");
+}
+
+allocator_numa::allocator_numa(
+    allocator_numa &&other) noexcept:
+    _state(std::move(other._state))
+{
+
+}
+
+allocator_numa &allocator_numa::operator=(
+    allocator_numa &&other) noexcept
+{
+    if (this != &other)
+    {
+        std::swap(_state, other._state);
+    }
+
+    return *this;
+}
+
+template<
+    typename F>
+void *allocator_numa::allocate_on_nodes(
+    F const &allocate_on_arena)
+{
+    size_t const preferred_node = get_current_node();
+
+    for (size_t i = 0; i < _state->arenas.size(); ++i)
+    {
+        size_t const node = (preferred_node + i) % _state->arenas.size();
+        node_arena &arena = *_state->arenas[node];
+
+        try
+        {
+            std::lock_guard<std::mutex> lock(arena.mutex);
+
+            return allocate_on_arena(arena.arena.get());
+        }
+        catch (std::bad_alloc const &)
+        {
+            warning_with_guard([&]()
+            {
+                return get_typename() + "::allocate(size_t, size_t) : arena of node " + std::to_string(node) + " is exhausted";
+            });
+        }
+    }
+
+    error_with_guard(get_typename() + "::allocate(size_t, size_t) : all node arenas are exhausted");
+
+    throw std::bad_alloc();
+}
+
+[[nodiscard]] void *allocator_numa::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    return allocate_on_nodes([value_size, values_count](allocator *arena)
+    {
+        return arena->allocate(value_size, values_count);
+    });
+}
+
+[[nodiscard]] void *allocator_numa::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    return allocate_on_nodes([value_size, values_count, alignment](allocator *arena)
+    {
+        return arena->allocate(value_size, values_count, alignment);
+    });
+}
+
+void allocator_numa::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    node_arena *arena = find_owning_arena(at);
+
+    if (arena == nullptr)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    std::lock_guard<std::mutex> lock(arena->mutex);
+    arena->arena->deallocate(at);
+}
+
+bool allocator_numa::try_expand_in_place(
+    void *at,
+    size_t value_size,
+    size_t values_count)
+{
+    node_arena *arena = find_owning_arena(at);
+
+    if (arena == nullptr)
+    {
+        error_with_guard(get_typename() + "::try_expand_in_place(void *, size_t, size_t) : attempt to expand block not owned by allocator");
+
+        throw std::logic_error("attempt to expand block not owned by allocator");
+    }
+
+    std::lock_guard<std::mutex> lock(arena->mutex);
+
+    return arena->arena->try_expand_in_place(at, value_size, values_count);
+}
+
+size_t allocator_numa::get_nodes_count() const noexcept
+{
+    return _state->arenas.size();
+}
+
+size_t allocator_numa::get_current_node() const noexcept
+{
+    int const cpu = sched_getcpu();
+
+    return cpu < 0 || static_cast<size_t>(cpu) >= _state->nodes_by_cpu.size()
+        ? 0
+        : _state->nodes_by_cpu[cpu];
+}
+
+size_t allocator_numa::get_owning_node(
+    void *at) const
+{
+    node_arena *arena = find_owning_arena(at);
+
+    if (arena == nullptr)
+    {
+        throw std::logic_error("block is not owned by allocator");
+    }
+
+    return arena->node;
+}
+
+inline allocator *allocator_numa::get_allocator() const
+{
+    return _state->arenas[get_current_node()]->arena.get();
+}
+
+inline logger *allocator_numa::get_logger() const
+{
+    return _state->target_logger;
+}
+
+inline std::string allocator_numa::get_typename() const noexcept
+{
+    return "allocator_numa";
+}
+
+allocator_numa::node_arena *allocator_numa::find_owning_arena(
+    void *at) const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(_state->ranges_mutex);
+    auto range = _state->ranges.upper_bound(reinterpret_cast<uintptr_t>(at));
+
+    if (range == _state->ranges.begin() || (--range)->second.first <= reinterpret_cast<uintptr_t>(at))
+    {
+        return nullptr;
+    }
+
+    return _state->arenas[range->second.second].get();
+}
\ No newline at end of file
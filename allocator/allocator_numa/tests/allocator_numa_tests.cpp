@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <allocator_numa.h>
+#include <allocator_sorted_list.h>
+
+TEST(allocatorNumaPositiveTests, test1)
+{
+    std::vector<allocator *> arenas;
+    auto *subject = new allocator_numa([&arenas](allocator *node_memory)
+    {
+        arenas.push_back(new allocator_sorted_list(10000, node_memory, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+        
+        return arenas.back();
+    });
+    
+    ASSERT_GE(subject->get_nodes_count(), 1);
+    ASSERT_EQ(arenas.size(), subject->get_nodes_count());
+    ASSERT_LT(subject->get_current_node(), subject->get_nodes_count());
+    
+    std::vector<void *> blocks;
+    
+    for (size_t i = 1; i <= 10; ++i)
+    {
+        blocks.push_back(subject->allocate(sizeof(int), i * 10));
+        
+        ASSERT_LT(subject->get_owning_node(blocks.back()), subject->get_nodes_count());
+        
+        if (subject->get_nodes_count() == 1)
+        {
+            ASSERT_EQ(subject->get_owning_node(blocks.back()), 0);
+        }
+    }
+    
+    void *aligned_block = subject->allocate(sizeof(unsigned char), 100, 64);
+    
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned_block) % 64, 0);
+    
+    subject->deallocate(aligned_block);
+    
+    for (void *block: blocks)
+    {
+        subject->deallocate(block);
+    }
+    
+    for (allocator *arena: arenas)
+    {
+        auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(arena)->get_blocks_info();
+        
+        ASSERT_EQ(actual_blocks_state.size(), 1);
+        ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    }
+    
+    delete subject;
+}
+
+TEST(allocatorNumaPositiveTests, test2)
+{
+    std::vector<allocator *> arenas;
+    allocator *subject = new allocator_numa([&arenas](allocator *node_memory)
+    {
+        arenas.push_back(new allocator_sorted_list(1 << 21, node_memory, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+        
+        return arenas.back();
+    });
+    
+    int const threads_count = 4;
+    int const blocks_count = 2000;
+    std::vector<std::vector<unsigned char *>> blocks(threads_count);
+    std::vector<std::thread> threads;
+    
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back([subject, &blocks, i]()
+        {
+            for (int j = 0; j < blocks_count; j++)
+            {
+                size_t const size = 1 + (i * 31 + j * 17) % 200;
+                auto *block = reinterpret_cast<unsigned char *>(subject->allocate(sizeof(unsigned char), size));
+                std::fill(block, block + size, static_cast<unsigned char>(i));
+                blocks[i].push_back(block);
+            }
+        });
+    }
+    
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    
+    threads.clear();
+    
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back([subject, &blocks, i]()
+        {
+            int const producer = (i + 1) % threads_count;
+            
+            for (auto *block: blocks[producer])
+            {
+                ASSERT_EQ(*block, static_cast<unsigned char>(producer));
+                subject->deallocate(block);
+            }
+        });
+    }
+    
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    
+    for (allocator *arena: arenas)
+    {
+        auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(arena)->get_blocks_info();
+        
+        ASSERT_EQ(actual_blocks_state.size(), 1);
+        ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    }
+    
+    delete subject;
+}
+
+TEST(allocatorNumaNegativeTests, test1)
+{
+    allocator *subject = new allocator_numa([](allocator *node_memory)
+    {
+        return new allocator_sorted_list(1000, node_memory, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    });
+    int foreign_value = 0;
+    
+    ASSERT_THROW(subject->allocate(sizeof(char), 2000), std::bad_alloc);
+    ASSERT_THROW(subject->deallocate(&foreign_value), std::logic_error);
+    
+    delete subject;
+    
+    ASSERT_THROW(allocator_numa([](allocator *) { return nullptr; }), std::logic_error);
+    ASSERT_THROW(allocator_numa([](allocator *)
+    {
+        return new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    }), std::logic_error);
+    ASSERT_THROW(allocator_numa([](allocator *node_memory)
+    {
+        return new allocator_sorted_list(1000, node_memory, nullptr, allocator_with_fit_mode::fit_mode::first_fit, std::vector<size_t>(),
+            trusted_memory_backing(trusted_memory_backing::kind::anonymous_mapping, 1 << 16));
+    }), std::logic_error);
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_POOL_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_POOL_H
+
+#include <allocator_address_directory.h>
+#include <allocator_debug_mode.h>
+#include <allocator_guardant.h>
+#include <allocator_with_statistics.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_pool final:
+    private allocator_guardant,
+    public allocator,
+    public allocator_with_statistics,
+    private logger_guardant,
+    private typename_holder
+{
+
+private:
+    
+    void *_trusted_memory;
+
+public:
+    
+    ~allocator_pool() override;
+    
+    allocator_pool(
+        allocator_pool const &other) = delete;
+    
+    allocator_pool &operator=(
+        allocator_pool const &other) = delete;
+    
+    allocator_pool(
+        allocator_pool &&other) noexcept;
+    
+    allocator_pool &operator=(
+        allocator_pool &&other) noexcept;
+
+public:
+    
+    explicit allocator_pool(
+        size_t slot_size,
+        size_t slots_per_slab = 64,
+        allocator *parent_allocator = nullptr,
+        logger *logger = nullptr,
+        bool align_slots_to_cache_line = false);
+
+public:
+    
+    using allocator::allocate;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    void deallocate(
+        void *at) override;
+
+public:
+    
+    size_t get_slot_size() const noexcept;
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t cache_line_size() noexcept;
+    
+    inline size_t obtain_slot_stride() const noexcept;
+    
+    inline size_t obtain_slots_per_slab() const noexcept;
+    
+    inline size_t obtain_slot_alignment() const noexcept;
+    
+    inline void *&obtain_first_free_slot() const noexcept;
+    
+    inline void **&obtain_slabs() const noexcept;
+    
+    inline size_t &obtain_slabs_count() const noexcept;
+    
+    inline size_t &obtain_slabs_capacity() const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    static inline void *&obtain_next_free_slot(
+        void *slot) noexcept;
+    
+    inline unsigned char *obtain_slab_first_slot(
+        void *slab) const noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region slabs directory
+    
+    void allocate_slab();
+    
+    void release_slabs();
+    
+    bool is_slot(
+        void *at) const noexcept;
+    
+    // endregion slabs directory
+    
+    // region debug checks
+    
+    bool is_free_slot(
+        void *slot) const noexcept;
+    
+    void poison_free_slot(
+        void *slot) const noexcept;
+    
+    // endregion debug checks
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_POOL_H
\ No newline at end of file
@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "../include/allocator_pool.h"
+
+allocator_pool::~allocator_pool()
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard(get_typename() + "::~allocator_pool() : called");
+    release_slabs();
+    deallocate_with_guard(_trusted_memory);
+}
+
+allocator_pool::allocator_pool(
+    allocator_pool &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
+{
+    other._trusted_memory = nullptr;
+}
+
+allocator_pool &allocator_pool::operator=(
+    allocator_pool &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_slabs();
+            deallocate_with_guard(_trusted_memory);
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
+}
+
+allocator_pool::allocator_pool(
+    size_t slot_size,
+    size_t slots_per_slab,
+    allocator *parent_allocator,
+    logger *logger,
+    bool align_slots_to_cache_line)
+{
+    if (slot_size == 0 || slots_per_slab == 0)
+    {
+        throw std::logic_error("slot size and slots per slab count must be positive");
+    }
+
+    size_t const slot_alignment = align_slots_to_cache_line
+        ? cache_line_size()
+        : alignof(std::max_align_t);
+
+    if (slot_size > (std::numeric_limits<size_t>::max() - slot_alignment) / slots_per_slab)
+    {
+        throw std::logic_error("slab size overflows");
+    }
+
+    size_t const slot_stride = (std::max(slot_size, sizeof(void *)) + slot_alignment - 1) / slot_alignment * slot_alignment;
+
+    _trusted_memory = parent_allocator == nullptr
+        ? ::operator new(meta_size())
+        : parent_allocator->allocate(1, meta_size());
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<size_t *>(memory) = slot_stride;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = slots_per_slab;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = slot_alignment;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<void ***>(memory) = nullptr;
+    memory += sizeof(void **);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+
+    obtain_statistics_counters().reset();
+
+    debug_with_guard(get_typename() + "::allocator_pool(size_t, size_t, allocator *, logger *, bool) : "
+        + "pool of " + std::to_string(slot_stride) + " byte slots constructed");
+}
+
+[[nodiscard]] void *allocator_pool::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (values_count != 0 && value_size > obtain_slot_stride() / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t) : requested size exceeds slot size "
+            + std::to_string(obtain_slot_stride()));
+
+        throw std::bad_alloc();
+    }
+
+    void *&first_free_slot = obtain_first_free_slot();
+
+    if (first_free_slot == nullptr)
+    {
+        allocate_slab();
+    }
+
+    void *slot = first_free_slot;
+    first_free_slot = obtain_next_free_slot(slot);
+    allocator_debug_mode::clear_poison(reinterpret_cast<unsigned char *>(slot) + sizeof(void *), obtain_slot_stride() - sizeof(void *));
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.allocations_count;
+    --counters.free_blocks_count;
+    counters.bytes_in_use += obtain_slot_stride();
+
+    return slot;
+}
+
+void allocator_pool::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+
+    if (!is_slot(at))
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    if (allocator_debug_mode::is_enabled() && is_free_slot(at))
+    {
+        critical_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate slot twice");
+
+        throw std::logic_error("attempt to deallocate slot twice");
+    }
+
+    void *&first_free_slot = obtain_first_free_slot();
+
+    obtain_next_free_slot(at) = first_free_slot;
+    first_free_slot = at;
+    poison_free_slot(at);
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.deallocations_count;
+    ++counters.free_blocks_count;
+    counters.bytes_in_use -= obtain_slot_stride();
+}
+
+size_t allocator_pool::get_slot_size() const noexcept
+{
+    return obtain_slot_stride();
+}
+
+allocator_with_statistics::statistics allocator_pool::get_statistics() const noexcept
+{
+    allocator_with_statistics::statistics_counters const &counters = obtain_statistics_counters();
+
+    return collect_statistics(counters, counters.bytes_in_use + counters.free_blocks_count * obtain_slot_stride(), counters.free_blocks_count == 0
+        ? 0
+        : obtain_slot_stride());
+}
+
+void allocator_pool::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
+}
+
+inline allocator *allocator_pool::get_allocator() const
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+inline logger *allocator_pool::get_logger() const
+{
+    return *reinterpret_cast<logger **>(_trusted_memory);
+}
+
+inline std::string allocator_pool::get_typename() const noexcept
+{
+    return "allocator_pool";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_pool::meta_size() noexcept
+{
+    return sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void *) + sizeof(void **) + sizeof(size_t) * 2
+        + sizeof(allocator_with_statistics::statistics_counters);
+}
+
+constexpr size_t allocator_pool::cache_line_size() noexcept
+{
+    return 64;
+}
+
+inline size_t allocator_pool::obtain_slot_stride() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline size_t allocator_pool::obtain_slots_per_slab() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t));
+}
+
+inline size_t allocator_pool::obtain_slot_alignment() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 2);
+}
+
+inline void *&allocator_pool::obtain_first_free_slot() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3);
+}
+
+inline void **&allocator_pool::obtain_slabs() const noexcept
+{
+    return *reinterpret_cast<void ***>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void *));
+}
+
+inline size_t &allocator_pool::obtain_slabs_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void *) + sizeof(void **));
+}
+
+inline size_t &allocator_pool::obtain_slabs_capacity() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void *) + sizeof(void **) + sizeof(size_t));
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_pool::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void *) + sizeof(void **) + sizeof(size_t) * 2);
+}
+
+inline void *&allocator_pool::obtain_next_free_slot(
+    void *slot) noexcept
+{
+    return *reinterpret_cast<void **>(slot);
+}
+
+inline unsigned char *allocator_pool::obtain_slab_first_slot(
+    void *slab) const noexcept
+{
+    size_t const slot_alignment = obtain_slot_alignment();
+
+    return reinterpret_cast<unsigned char *>((reinterpret_cast<uintptr_t>(slab) + slot_alignment - 1) / slot_alignment * slot_alignment);
+}
+
+// endregion trusted memory layout
+
+void allocator_pool::allocate_slab()
+{
+    size_t const slot_stride = obtain_slot_stride();
+    size_t const slots_per_slab = obtain_slots_per_slab();
+
+    void *slab = allocate_with_guard(1, obtain_slot_alignment() - 1 + slot_stride * slots_per_slab);
+
+    try
+    {
+        allocator_address_directory::insert(obtain_slabs(), obtain_slabs_count(), obtain_slabs_capacity(), slab, *this);
+    }
+    catch (...)
+    {
+        deallocate_with_guard(slab);
+
+        throw;
+    }
+
+    auto *slot = obtain_slab_first_slot(slab) + slot_stride * slots_per_slab;
+
+    for (size_t i = 0; i < slots_per_slab; ++i)
+    {
+        slot -= slot_stride;
+        obtain_next_free_slot(slot) = obtain_first_free_slot();
+        obtain_first_free_slot() = slot;
+        poison_free_slot(slot);
+    }
+
+    obtain_statistics_counters().free_blocks_count += slots_per_slab;
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::allocate_slab() : slab of " + std::to_string(slots_per_slab) + " slots allocated";
+    });
+}
+
+void allocator_pool::release_slabs()
+{
+    void **slabs = obtain_slabs();
+
+    for (size_t i = 0; i < obtain_slabs_count(); ++i)
+    {
+        deallocate_with_guard(slabs[i]);
+    }
+
+    allocator_address_directory::release(obtain_slabs(), obtain_slabs_count(), obtain_slabs_capacity(), *this);
+    obtain_first_free_slot() = nullptr;
+}
+
+bool allocator_pool::is_slot(
+    void *at) const noexcept
+{
+    void *slab = allocator_address_directory::find_preceding(obtain_slabs(), obtain_slabs_count(), at);
+
+    if (slab == nullptr)
+    {
+        return false;
+    }
+
+    auto const first_slot_address = reinterpret_cast<uintptr_t>(obtain_slab_first_slot(slab));
+    auto const address = reinterpret_cast<uintptr_t>(at);
+    size_t const slot_stride = obtain_slot_stride();
+
+    return address >= first_slot_address
+        && address < first_slot_address + slot_stride * obtain_slots_per_slab()
+        && (address - first_slot_address) % slot_stride == 0;
+}
+
+bool allocator_pool::is_free_slot(
+    void *slot) const noexcept
+{
+    return allocator_debug_mode::is_poisoned(reinterpret_cast<unsigned char *>(slot) + sizeof(void *), obtain_slot_stride() - sizeof(void *));
+}
+
+void allocator_pool::poison_free_slot(
+    void *slot) const noexcept
+{
+    // a free slot keeps its free list link in front and poison behind it, which tells a second deallocation apart
+    allocator_debug_mode::poison(reinterpret_cast<unsigned char *>(slot) + sizeof(void *), obtain_slot_stride() - sizeof(void *));
+}
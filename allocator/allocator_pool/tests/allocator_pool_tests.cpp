@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <allocator_pool.h>
+#include <allocator_sorted_list.h>
+
+TEST(allocatorPoolPositiveTests, test1)
+{
+    allocator *parent_allocator = new allocator_sorted_list(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    allocator *subject = new allocator_pool(40, 8, parent_allocator);
+    
+    std::vector<void *> slots;
+    for (int i = 0; i < 20; ++i)
+    {
+        slots.push_back(subject->allocate(40, 1));
+    }
+    
+    std::sort(slots.begin(), slots.end());
+    ASSERT_EQ(std::unique(slots.begin(), slots.end()), slots.end());
+    
+    void *released_slot = slots[7];
+    subject->deallocate(released_slot);
+    
+    ASSERT_EQ(subject->allocate(sizeof(int), 2), released_slot);
+    
+    delete subject;
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(parent_allocator)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete parent_allocator;
+}
+
+TEST(allocatorPoolPositiveTests, test2)
+{
+    allocator_pool subject(24, 16, nullptr, nullptr, true);
+    
+    ASSERT_EQ(subject.get_slot_size(), 64);
+    
+    for (int i = 0; i < 40; ++i)
+    {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(subject.allocate(24, 1)) % 64, 0);
+    }
+}
+
+TEST(allocatorPoolPositiveTests, test3)
+{
+    allocator_pool subject(32, 4);
+    
+    std::vector<void *> slots;
+    for (int i = 0; i < 5; ++i)
+    {
+        slots.push_back(subject.allocate(32, 1));
+    }
+    
+    subject.deallocate(slots.back());
+    
+    auto statistics = subject.get_statistics();
+    
+    ASSERT_EQ(statistics.allocations_count, 5);
+    ASSERT_EQ(statistics.deallocations_count, 1);
+    ASSERT_EQ(statistics.bytes_in_use, 4 * 32);
+    ASSERT_EQ(statistics.bytes_free, 4 * 32);
+    ASSERT_EQ(statistics.free_blocks_count, 4);
+    ASSERT_EQ(statistics.largest_free_block_size, 32);
+}
+
+TEST(allocatorPoolFalsePositiveTests, test1)
+{
+    ASSERT_THROW(allocator_pool(0), std::logic_error);
+    
+    allocator_pool subject(32);
+    
+    ASSERT_THROW(static_cast<void>(subject.allocate(sizeof(char), 33)), std::bad_alloc);
+    
+    allocator_pool another_subject(32);
+    auto *slot = reinterpret_cast<unsigned char *>(subject.allocate(sizeof(char), 32));
+    int foreign_value = 0;
+    
+    ASSERT_THROW(another_subject.deallocate(slot), std::logic_error);
+    ASSERT_THROW(subject.deallocate(&foreign_value), std::logic_error);
+    ASSERT_THROW(subject.deallocate(slot + 8), std::logic_error);
+    
+    subject.deallocate(slot);
+}
+
+TEST(allocatorPoolFalsePositiveTests, test2)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator_pool subject(32);
+    
+    void *first_slot = subject.allocate(sizeof(char), 32);
+    void *second_slot = subject.allocate(sizeof(char), 32);
+    
+    subject.deallocate(first_slot);
+    
+    ASSERT_THROW(subject.deallocate(first_slot), std::logic_error);
+    
+    subject.deallocate(second_slot);
+}
+
+int main(
+    int argc,
+    char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
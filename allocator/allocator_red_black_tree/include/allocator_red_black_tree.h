@@ -1,16 +1,22 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_RED_BLACK_TREE_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_RED_BLACK_TREE_H
 
+#include <utility>
+#include <allocator_debug_mode.h>
+#include <allocator_growth_policy.h>
 #include <allocator_guardant.h>
 #include <allocator_test_utils.h>
 #include <allocator_with_fit_mode.h>
+#include <allocator_with_statistics.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <trusted_memory_backing.h>
 
 class allocator_red_black_tree final:
     private allocator_guardant,
     public allocator_test_utils,
     public allocator_with_fit_mode,
+    public allocator_with_statistics,
     private logger_guardant,
     private typename_holder
 {
@@ -24,10 +30,10 @@ public:
     ~allocator_red_black_tree() override;
     
     allocator_red_black_tree(
-        allocator_red_black_tree const &other);
+        allocator_red_black_tree const &other) = delete;
     
     allocator_red_black_tree &operator=(
-        allocator_red_black_tree const &other);
+        allocator_red_black_tree const &other) = delete;
     
     allocator_red_black_tree(
         allocator_red_black_tree &&other) noexcept;
@@ -41,7 +47,9 @@ public:
         size_t space_size,
         allocator *parent_allocator = nullptr,
         logger *logger = nullptr,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing const &backing = trusted_memory_backing(),
+        allocator_growth_policy const &growth_policy = allocator_growth_policy());
 
 public:
     
@@ -49,8 +57,18 @@ public:
         size_t value_size,
         size_t values_count) override;
     
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
     void deallocate(
         void *at) override;
+    
+    bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count) override;
 
 public:
     
@@ -64,6 +82,15 @@ private:
 public:
     
     std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+    
+    std::vector<std::vector<allocator_test_utils::block_info>> get_segments_blocks_info() const noexcept override;
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
 
 private:
     
@@ -72,6 +99,182 @@ private:
 private:
     
     inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t occupied_block_meta_size() noexcept;
+    
+    static constexpr size_t free_block_meta_size() noexcept;
+    
+    // whole blocks are kept multiples of the maximum alignment and the first block is placed so its payload is aligned, so every payload stays aligned
+    static constexpr size_t round_up_payload_size(
+        size_t payload_size) noexcept;
+    
+    static constexpr size_t segment_meta_size() noexcept;
+    
+    inline allocator_with_fit_mode::fit_mode &obtain_fit_mode() const noexcept;
+    
+    inline size_t obtain_space_size() const noexcept;
+    
+    inline void *&obtain_root() const noexcept;
+    
+    inline void *obtain_first_block() const noexcept;
+    
+    inline void *obtain_space_end() const noexcept;
+    
+    inline trusted_memory_backing &obtain_trusted_memory_backing() const noexcept;
+    
+    inline allocator_growth_policy &obtain_growth_policy() const noexcept;
+    
+    inline void *&obtain_last_segment() const noexcept;
+    
+    inline size_t &obtain_segments_count() const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    void release_trusted_memory();
+    
+    static inline size_t obtain_block_payload_size(
+        void *block) noexcept;
+    
+    static inline void set_block_payload_size(
+        void *block,
+        size_t payload_size) noexcept;
+    
+    static inline bool is_block_occupied(
+        void *block) noexcept;
+    
+    static inline void set_block_occupied(
+        void *block,
+        bool is_occupied) noexcept;
+    
+    static inline void *&obtain_previous_block(
+        void *block) noexcept;
+    
+    static inline void *obtain_next_block(
+        void *block) noexcept;
+    
+    static inline block_pointer_t &obtain_block_owner(
+        void *block) noexcept;
+    
+    static inline size_t obtain_leading_fragment_size(
+        void *block,
+        size_t alignment) noexcept;
+    
+    static inline void *&obtain_previous_segment(
+        void *segment) noexcept;
+    
+    static inline size_t &obtain_segment_space_size(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_first_block(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_space_end(
+        void *segment) noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region segments manipulation
+    
+    bool is_owned_block_address(
+        void *block) const noexcept;
+    
+    void *obtain_owning_space_end(
+        void *block) const noexcept;
+    
+    std::vector<std::pair<void *, void *>> obtain_segments_bounds() const;
+    
+    bool try_grow(
+        size_t requested_size);
+    
+    bool try_release_segment(
+        void *block) noexcept;
+    
+    // endregion segments manipulation
+    
+    // region red-black tree
+    
+    static inline bool is_node_red(
+        void *node) noexcept;
+    
+    static inline void set_node_red(
+        void *node,
+        bool is_red) noexcept;
+    
+    static inline void *&obtain_parent(
+        void *node) noexcept;
+    
+    static inline void *&obtain_left_subtree(
+        void *node) noexcept;
+    
+    static inline void *&obtain_right_subtree(
+        void *node) noexcept;
+    
+    static inline size_t &obtain_subtree_max_size(
+        void *node) noexcept;
+    
+    static inline void *&obtain_subtree_lowest_address(
+        void *node) noexcept;
+    
+    static inline bool is_node_less(
+        void *first,
+        void *second) noexcept;
+    
+    static void update_augmentation(
+        void *node) noexcept;
+    
+    static void update_augmentation_up_to_root(
+        void *node) noexcept;
+    
+    void *&obtain_link_to(
+        void *node) const noexcept;
+    
+    void rotate_left(
+        void *node) noexcept;
+    
+    void rotate_right(
+        void *node) noexcept;
+    
+    void insert_free_block(
+        void *block) noexcept;
+    
+    void remove_free_block(
+        void *block) noexcept;
+    
+    void *find_best_fit(
+        size_t size) const noexcept;
+    
+    void *find_worst_fit(
+        size_t size) const noexcept;
+    
+    void *find_first_fit(
+        size_t size) const noexcept;
+    
+    // endregion red-black tree
+    
+    // region debug checks
+    
+    void verify_block_neighbourhood(
+        void *block,
+        char const *method_signature) const;
+    
+    bool is_block_intact(
+        void *block) const noexcept;
+    
+    static void poison_free_block(
+        void *block) noexcept;
+    
+    static void poison_free_block(
+        void *block,
+        void *freed_block,
+        size_t freed_size) noexcept;
+    
+    // endregion debug checks
     
 };
 
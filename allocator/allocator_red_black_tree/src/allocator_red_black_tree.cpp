@@ -1,80 +1,1294 @@
-#include <not_implemented.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 
 #include "../include/allocator_red_black_tree.h"
 
 allocator_red_black_tree::~allocator_red_black_tree()
 {
-    throw not_implemented("allocator_red_black_tree::~allocator_red_black_tree()", "your code should be here...");
-}
-
-allocator_red_black_tree::allocator_red_black_tree(
-    allocator_red_black_tree const &other)
-{
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(allocator_red_black_tree const &)", "your code should be here...");
-}
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
 
-allocator_red_black_tree &allocator_red_black_tree::operator=(
-    allocator_red_black_tree const &other)
-{
-    throw not_implemented("allocator_red_black_tree &allocator_red_black_tree::operator=(allocator_red_black_tree const &)", "your code should be here...");
+    debug_with_guard(get_typename() + "::~allocator_red_black_tree() : called");
+    release_trusted_memory();
 }
 
 allocator_red_black_tree::allocator_red_black_tree(
-    allocator_red_black_tree &&other) noexcept
+    allocator_red_black_tree &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(allocator_red_black_tree &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_red_black_tree &allocator_red_black_tree::operator=(
     allocator_red_black_tree &&other) noexcept
 {
-    throw not_implemented("allocator_red_black_tree &allocator_red_black_tree::operator=(allocator_red_black_tree &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_trusted_memory();
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
 }
 
 allocator_red_black_tree::allocator_red_black_tree(
     size_t space_size,
     allocator *parent_allocator,
     logger *logger,
-    allocator_with_fit_mode::fit_mode allocate_fit_mode)
+    allocator_with_fit_mode::fit_mode allocate_fit_mode,
+    trusted_memory_backing const &backing,
+    allocator_growth_policy const &growth_policy)
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < free_block_meta_size())
+    {
+        throw std::logic_error("space size is too small to store even a single block");
+    }
+
+    size_t const trusted_memory_size = meta_size() + space_size;
+    _trusted_memory = backing.allocate(trusted_memory_size, parent_allocator);
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<size_t *>(memory) = space_size;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<trusted_memory_backing *>(memory) = backing;
+    memory += sizeof(trusted_memory_backing);
+
+    *reinterpret_cast<allocator_growth_policy *>(memory) = growth_policy;
+    memory += sizeof(allocator_growth_policy);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<size_t *>(memory) = 1;
+    memory += sizeof(size_t);
+
+    obtain_statistics_counters().reset();
+    memory += sizeof(allocator_with_statistics::statistics_counters);
+
+    *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(memory) = allocate_fit_mode;
+
+    void *first_block = obtain_first_block();
+    *reinterpret_cast<block_size_t *>(first_block) = 0;
+    set_block_payload_size(first_block, space_size - occupied_block_meta_size());
+    obtain_previous_block(first_block) = nullptr;
+    insert_free_block(first_block);
+    poison_free_block(first_block);
+
+    debug_with_guard(get_typename() + "::allocator_red_black_tree(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode, trusted_memory_backing const &, allocator_growth_policy const &) : "
+        + "allocator with " + std::to_string(space_size) + " bytes of space constructed");
 }
 
 [[nodiscard]] void *allocator_red_black_tree::allocate(
     size_t value_size,
     size_t values_count)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_red_black_tree::allocate(size_t, size_t)", "your code should be here...");
+    return allocate(value_size, values_count, alignof(std::max_align_t));
+}
+
+[[nodiscard]] void *allocator_red_black_tree::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (!is_valid_alignment(alignment))
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : alignment " + std::to_string(alignment) + " is not a power of two");
+
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    if (values_count != 0 && value_size > ((std::numeric_limits<size_t>::max() >> 2) - alignment - free_block_meta_size() - allocator_debug_mode::canary_size()) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_size = round_up_payload_size(value_size * values_count + allocator_debug_mode::canary_size());
+    size_t const search_size = alignment <= alignof(std::max_align_t)
+        ? requested_size
+        : requested_size + alignment + free_block_meta_size();
+    void *block = nullptr;
+
+    if (obtain_root() == nullptr || obtain_subtree_max_size(obtain_root()) < search_size)
+    {
+        try_grow(search_size);
+    }
+
+    if (obtain_root() != nullptr && obtain_subtree_max_size(obtain_root()) >= search_size)
+    {
+        switch (obtain_fit_mode())
+        {
+            case allocator_with_fit_mode::fit_mode::first_fit:
+                block = find_first_fit(search_size);
+                break;
+            case allocator_with_fit_mode::fit_mode::the_best_fit:
+                block = find_best_fit(search_size);
+                break;
+            case allocator_with_fit_mode::fit_mode::the_worst_fit:
+                block = find_worst_fit(search_size);
+                break;
+        }
+    }
+
+    if (block == nullptr)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : can't allocate "
+            + std::to_string(requested_size) + " bytes");
+
+        throw std::bad_alloc();
+    }
+
+    remove_free_block(block);
+
+    size_t const leading_fragment_size = obtain_leading_fragment_size(block, alignment);
+
+    if (leading_fragment_size != 0)
+    {
+        void *leading_fragment = block;
+        size_t const block_payload_size = obtain_block_payload_size(leading_fragment);
+        set_block_payload_size(leading_fragment, leading_fragment_size - occupied_block_meta_size());
+
+        block = obtain_next_block(leading_fragment);
+        *reinterpret_cast<block_size_t *>(block) = 0;
+        set_block_payload_size(block, block_payload_size - leading_fragment_size);
+        obtain_previous_block(block) = leading_fragment;
+
+        void *following_block = obtain_next_block(block);
+        if (following_block != obtain_space_end())
+        {
+            obtain_previous_block(following_block) = block;
+        }
+
+        insert_free_block(leading_fragment);
+    }
+
+    size_t const payload_size = obtain_block_payload_size(block);
+
+    if (payload_size - requested_size >= free_block_meta_size())
+    {
+        set_block_payload_size(block, requested_size);
+
+        void *rest_block = obtain_next_block(block);
+        *reinterpret_cast<block_size_t *>(rest_block) = 0;
+        set_block_payload_size(rest_block, payload_size - requested_size - occupied_block_meta_size());
+        obtain_previous_block(rest_block) = block;
+
+        void *following_block = obtain_next_block(rest_block);
+        if (following_block != obtain_space_end())
+        {
+            obtain_previous_block(following_block) = rest_block;
+        }
+
+        insert_free_block(rest_block);
+    }
+    else if (payload_size != requested_size)
+    {
+        warning_with_guard([&]()
+        {
+            return get_typename() + "::allocate(size_t, size_t, size_t) : requested size "
+                + std::to_string(requested_size) + " was enlarged to " + std::to_string(payload_size);
+        });
+    }
+
+    set_block_occupied(block, true);
+    obtain_block_owner(block) = _trusted_memory;
+    allocator_debug_mode::set_canary(obtain_next_block(block));
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.allocations_count;
+    counters.bytes_in_use += obtain_block_payload_size(block) + occupied_block_meta_size();
+
+    return reinterpret_cast<unsigned char *>(block) + occupied_block_meta_size();
 }
 
 void allocator_red_black_tree::deallocate(
     void *at)
 {
-    throw not_implemented("void allocator_red_black_tree::deallocate(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+    void *block = reinterpret_cast<unsigned char *>(at) - occupied_block_meta_size();
+
+    if (!is_owned_block_address(block)
+        || !is_block_occupied(block) || obtain_block_owner(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    if (allocator_debug_mode::is_enabled())
+    {
+        verify_block_neighbourhood(block, "deallocate(void *)");
+    }
+
+    void *freed_block = block;
+    size_t const freed_size = obtain_block_payload_size(block) + occupied_block_meta_size();
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.deallocations_count;
+    counters.bytes_in_use -= freed_size;
+
+    set_block_occupied(block, false);
+
+    void *next_block = obtain_next_block(block);
+    if (next_block != obtain_space_end() && !is_block_occupied(next_block))
+    {
+        remove_free_block(next_block);
+        set_block_payload_size(block, obtain_block_payload_size(block) + occupied_block_meta_size() + obtain_block_payload_size(next_block));
+    }
+
+    void *previous_block = obtain_previous_block(block);
+    if (previous_block != nullptr && !is_block_occupied(previous_block))
+    {
+        remove_free_block(previous_block);
+        set_block_payload_size(previous_block, obtain_block_payload_size(previous_block) + occupied_block_meta_size() + obtain_block_payload_size(block));
+        block = previous_block;
+    }
+
+    next_block = obtain_next_block(block);
+    if (next_block != obtain_space_end())
+    {
+        obtain_previous_block(next_block) = block;
+    }
+
+    insert_free_block(block);
+    poison_free_block(block, freed_block, freed_size);
+
+    obtain_trusted_memory_backing().release_free_pages(reinterpret_cast<unsigned char *>(block) + free_block_meta_size(),
+        obtain_block_payload_size(block) + occupied_block_meta_size() - free_block_meta_size(), freed_block, freed_size);
+
+    try_release_segment(block);
+}
+
+bool allocator_red_black_tree::try_expand_in_place(
+    void *at,
+    size_t value_size,
+    size_t values_count)
+{
+    void *block = reinterpret_cast<unsigned char *>(at) - occupied_block_meta_size();
+
+    if (!is_owned_block_address(block)
+        || !is_block_occupied(block) || obtain_block_owner(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::try_expand_in_place(void *, size_t, size_t) : attempt to expand block not owned by allocator");
+
+        throw std::logic_error("attempt to expand block not owned by allocator");
+    }
+
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() >> 2) / values_count)
+    {
+        return false;
+    }
+
+    size_t const requested_size = round_up_payload_size(value_size * values_count + allocator_debug_mode::canary_size());
+    size_t const payload_size = obtain_block_payload_size(block);
+
+    if (requested_size <= payload_size)
+    {
+        return true;
+    }
+
+    void *next_block = obtain_next_block(block);
+
+    if (next_block == obtain_space_end() || is_block_occupied(next_block)
+        || payload_size + occupied_block_meta_size() + obtain_block_payload_size(next_block) < requested_size)
+    {
+        return false;
+    }
+
+    remove_free_block(next_block);
+
+    size_t const expanded_size = payload_size + occupied_block_meta_size() + obtain_block_payload_size(next_block);
+    void *following_block;
+
+    if (expanded_size - requested_size >= free_block_meta_size())
+    {
+        set_block_payload_size(block, requested_size);
+
+        void *rest_block = obtain_next_block(block);
+        *reinterpret_cast<block_size_t *>(rest_block) = 0;
+        set_block_payload_size(rest_block, expanded_size - requested_size - occupied_block_meta_size());
+        obtain_previous_block(rest_block) = block;
+        insert_free_block(rest_block);
+
+        following_block = obtain_next_block(rest_block);
+        if (following_block != obtain_space_end())
+        {
+            obtain_previous_block(following_block) = rest_block;
+        }
+    }
+    else
+    {
+        set_block_payload_size(block, expanded_size);
+
+        following_block = obtain_next_block(block);
+        if (following_block != obtain_space_end())
+        {
+            obtain_previous_block(following_block) = block;
+        }
+    }
+
+    allocator_debug_mode::set_canary(obtain_next_block(block));
+    obtain_statistics_counters().bytes_in_use += obtain_block_payload_size(block) - payload_size;
+
+    return true;
 }
 
 inline void allocator_red_black_tree::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_red_black_tree::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    obtain_fit_mode() = mode;
 }
 
 inline allocator *allocator_red_black_tree::get_allocator() const
 {
-    throw not_implemented("inline allocator *allocator_red_black_tree::get_allocator() const", "your code should be here...");
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+allocator_with_statistics::statistics allocator_red_black_tree::get_statistics() const noexcept
+{
+    size_t space_size = obtain_space_size();
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        space_size += obtain_segment_space_size(segment);
+    }
+
+    return collect_statistics(obtain_statistics_counters(), space_size, obtain_root() == nullptr
+        ? 0
+        : obtain_subtree_max_size(obtain_root()) + occupied_block_meta_size());
+}
+
+void allocator_red_black_tree::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
 }
 
 std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info() const noexcept
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info() const noexcept", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> blocks_info;
+
+    for (auto const &segment_blocks_info: get_segments_blocks_info())
+    {
+        blocks_info.insert(blocks_info.end(), segment_blocks_info.begin(), segment_blocks_info.end());
+    }
+
+    return blocks_info;
+}
+
+std::vector<std::vector<allocator_test_utils::block_info>> allocator_red_black_tree::get_segments_blocks_info() const noexcept
+{
+    std::vector<std::vector<allocator_test_utils::block_info>> segments_blocks_info;
+
+    for (auto const &segment_bounds: obtain_segments_bounds())
+    {
+        segments_blocks_info.emplace_back();
+
+        for (void *block = segment_bounds.first; block < segment_bounds.second; block = obtain_next_block(block))
+        {
+            segments_blocks_info.back().push_back(
+                {
+                    obtain_block_payload_size(block) + occupied_block_meta_size(),
+                    is_block_occupied(block)
+                });
+        }
+    }
+
+    return segments_blocks_info;
 }
 
 inline logger *allocator_red_black_tree::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_red_black_tree::get_logger() const", "your code should be here...");
+    return *reinterpret_cast<logger **>(_trusted_memory);
 }
 
 inline std::string allocator_red_black_tree::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_red_black_tree::get_typename() const noexcept", "your code should be here...");
-}
\ No newline at end of file
+    return "allocator_red_black_tree";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_red_black_tree::meta_size() noexcept
+{
+    return round_up_to_max_alignment(sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *)
+        + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t)
+        + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(allocator_with_fit_mode::fit_mode) + occupied_block_meta_size()) - occupied_block_meta_size();
+}
+
+constexpr size_t allocator_red_black_tree::occupied_block_meta_size() noexcept
+{
+    return sizeof(block_size_t) + sizeof(void *) + sizeof(block_pointer_t);
+}
+
+constexpr size_t allocator_red_black_tree::free_block_meta_size() noexcept
+{
+    return sizeof(block_size_t) + sizeof(void *) * 5 + sizeof(size_t);
+}
+
+constexpr size_t allocator_red_black_tree::round_up_payload_size(
+    size_t payload_size) noexcept
+{
+    return round_up_to_max_alignment(std::max(payload_size, free_block_meta_size() - occupied_block_meta_size()) + occupied_block_meta_size())
+        - occupied_block_meta_size();
+}
+
+constexpr size_t allocator_red_black_tree::segment_meta_size() noexcept
+{
+    return round_up_to_max_alignment(sizeof(void *) + sizeof(size_t) + occupied_block_meta_size()) - occupied_block_meta_size();
+}
+
+inline allocator_with_fit_mode::fit_mode &allocator_red_black_tree::obtain_fit_mode() const noexcept
+{
+    return *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters));
+}
+
+inline size_t allocator_red_black_tree::obtain_space_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline void *&allocator_red_black_tree::obtain_root() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t));
+}
+
+inline void *allocator_red_black_tree::obtain_first_block() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size();
+}
+
+inline void *allocator_red_black_tree::obtain_space_end() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_first_block()) + obtain_space_size();
+}
+
+inline trusted_memory_backing &allocator_red_black_tree::obtain_trusted_memory_backing() const noexcept
+{
+    return *reinterpret_cast<trusted_memory_backing *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *));
+}
+
+inline allocator_growth_policy &allocator_red_black_tree::obtain_growth_policy() const noexcept
+{
+    return *reinterpret_cast<allocator_growth_policy *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(trusted_memory_backing));
+}
+
+inline void *&allocator_red_black_tree::obtain_last_segment() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy));
+}
+
+inline size_t &allocator_red_black_tree::obtain_segments_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *));
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_red_black_tree::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t));
+}
+
+void allocator_red_black_tree::release_trusted_memory()
+{
+    trusted_memory_backing const backing = obtain_trusted_memory_backing();
+
+    for (void *segment = obtain_last_segment(); segment != nullptr;)
+    {
+        void *previous_segment = obtain_previous_segment(segment);
+        backing.deallocate(segment, segment_meta_size() + obtain_segment_space_size(segment) + occupied_block_meta_size(), get_allocator());
+        segment = previous_segment;
+    }
+
+    backing.deallocate(_trusted_memory, reinterpret_cast<unsigned char *>(obtain_space_end()) - reinterpret_cast<unsigned char *>(_trusted_memory), get_allocator());
+}
+
+inline size_t allocator_red_black_tree::obtain_block_payload_size(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_size_t *>(block) & (std::numeric_limits<block_size_t>::max() >> 2);
+}
+
+inline void allocator_red_black_tree::set_block_payload_size(
+    void *block,
+    size_t payload_size) noexcept
+{
+    block_size_t &block_size = *reinterpret_cast<block_size_t *>(block);
+    block_size = (block_size & ~(std::numeric_limits<block_size_t>::max() >> 2)) | payload_size;
+}
+
+inline bool allocator_red_black_tree::is_block_occupied(
+    void *block) noexcept
+{
+    return (*reinterpret_cast<block_size_t *>(block) >> (std::numeric_limits<block_size_t>::digits - 1)) != 0;
+}
+
+inline void allocator_red_black_tree::set_block_occupied(
+    void *block,
+    bool is_occupied) noexcept
+{
+    block_size_t const flag = static_cast<block_size_t>(1) << (std::numeric_limits<block_size_t>::digits - 1);
+    block_size_t &block_size = *reinterpret_cast<block_size_t *>(block);
+    block_size = is_occupied
+        ? block_size | flag
+        : block_size & ~flag;
+}
+
+inline void *&allocator_red_black_tree::obtain_previous_block(
+    void *block) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(block) + sizeof(block_size_t));
+}
+
+inline void *allocator_red_black_tree::obtain_next_block(
+    void *block) noexcept
+{
+    return reinterpret_cast<unsigned char *>(block) + occupied_block_meta_size() + obtain_block_payload_size(block);
+}
+
+inline allocator::block_pointer_t &allocator_red_black_tree::obtain_block_owner(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_pointer_t *>(reinterpret_cast<unsigned char *>(block) + sizeof(block_size_t) + sizeof(void *));
+}
+
+inline size_t allocator_red_black_tree::obtain_leading_fragment_size(
+    void *block,
+    size_t alignment) noexcept
+{
+    auto const payload_address = reinterpret_cast<uintptr_t>(block) + occupied_block_meta_size();
+    size_t leading_fragment_size = (alignment - payload_address % alignment) % alignment;
+
+    while (leading_fragment_size != 0 && leading_fragment_size < free_block_meta_size())
+    {
+        leading_fragment_size += alignment;
+    }
+
+    return leading_fragment_size;
+}
+
+inline void *&allocator_red_black_tree::obtain_previous_segment(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<void **>(segment);
+}
+
+inline size_t &allocator_red_black_tree::obtain_segment_space_size(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(segment) + sizeof(void *));
+}
+
+inline void *allocator_red_black_tree::obtain_segment_first_block(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(segment) + segment_meta_size();
+}
+
+inline void *allocator_red_black_tree::obtain_segment_space_end(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_segment_first_block(segment)) + obtain_segment_space_size(segment);
+}
+
+// endregion trusted memory layout
+
+// region segments manipulation
+
+bool allocator_red_black_tree::is_owned_block_address(
+    void *block) const noexcept
+{
+    return obtain_owning_space_end(block) != nullptr;
+}
+
+void *allocator_red_black_tree::obtain_owning_space_end(
+    void *block) const noexcept
+{
+    if (block >= obtain_first_block() && block < obtain_space_end())
+    {
+        return obtain_space_end();
+    }
+
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        if (block >= obtain_segment_first_block(segment) && block < obtain_segment_space_end(segment))
+        {
+            return obtain_segment_space_end(segment);
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<std::pair<void *, void *>> allocator_red_black_tree::obtain_segments_bounds() const
+{
+    std::vector<std::pair<void *, void *>> segments_bounds { { obtain_first_block(), obtain_space_end() } };
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        segments_bounds.emplace(segments_bounds.begin() + 1, obtain_segment_first_block(segment), obtain_segment_space_end(segment));
+    }
+
+    return segments_bounds;
+}
+
+bool allocator_red_black_tree::try_grow(
+    size_t requested_size)
+{
+    allocator_growth_policy const &growth_policy = obtain_growth_policy();
+
+    if (!growth_policy.can_grow(obtain_segments_count())
+        || requested_size > (std::numeric_limits<size_t>::max() >> 2) - segment_meta_size() - occupied_block_meta_size() * 2)
+    {
+        return false;
+    }
+
+    size_t const segment_space_size = growth_policy.obtain_segment_size(obtain_space_size(), requested_size + occupied_block_meta_size());
+    void *segment = obtain_trusted_memory_backing().allocate(segment_meta_size() + segment_space_size + occupied_block_meta_size(), get_allocator());
+
+    obtain_previous_segment(segment) = obtain_last_segment();
+    obtain_segment_space_size(segment) = segment_space_size;
+    obtain_last_segment() = segment;
+    ++obtain_segments_count();
+
+    // a zero-sized occupied sentinel after the segment space stops coalescing at its end
+    void *sentinel = obtain_segment_space_end(segment);
+    *reinterpret_cast<block_size_t *>(sentinel) = 0;
+    set_block_occupied(sentinel, true);
+
+    void *block = obtain_segment_first_block(segment);
+    *reinterpret_cast<block_size_t *>(block) = 0;
+    set_block_payload_size(block, segment_space_size - occupied_block_meta_size());
+    obtain_previous_block(block) = nullptr;
+    obtain_previous_block(sentinel) = block;
+    insert_free_block(block);
+    poison_free_block(block);
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::allocate(size_t, size_t, size_t) : segment of "
+            + std::to_string(segment_space_size) + " bytes allocated";
+    });
+
+    return true;
+}
+
+bool allocator_red_black_tree::try_release_segment(
+    void *block) noexcept
+{
+    if (!obtain_growth_policy().is_releasing_empty_segments())
+    {
+        return false;
+    }
+
+    void *segment = reinterpret_cast<unsigned char *>(block) - segment_meta_size();
+    void *next_segment = nullptr;
+
+    for (void *current_segment = obtain_last_segment(); current_segment != segment; current_segment = obtain_previous_segment(current_segment))
+    {
+        if (current_segment == nullptr)
+        {
+            return false;
+        }
+
+        next_segment = current_segment;
+    }
+
+    if (obtain_block_payload_size(block) + occupied_block_meta_size() != obtain_segment_space_size(segment))
+    {
+        return false;
+    }
+
+    remove_free_block(block);
+
+    (next_segment == nullptr
+        ? obtain_last_segment()
+        : obtain_previous_segment(next_segment)) = obtain_previous_segment(segment);
+    --obtain_segments_count();
+
+    size_t const segment_space_size = obtain_segment_space_size(segment);
+    obtain_trusted_memory_backing().deallocate(segment, segment_meta_size() + segment_space_size + occupied_block_meta_size(), get_allocator());
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::deallocate(void *) : empty segment of "
+            + std::to_string(segment_space_size) + " bytes released";
+    });
+
+    return true;
+}
+
+// endregion segments manipulation
+
+// region red-black tree
+
+inline bool allocator_red_black_tree::is_node_red(
+    void *node) noexcept
+{
+    return node != nullptr
+        && ((*reinterpret_cast<block_size_t *>(node) >> (std::numeric_limits<block_size_t>::digits - 2)) & 1) != 0;
+}
+
+inline void allocator_red_black_tree::set_node_red(
+    void *node,
+    bool is_red) noexcept
+{
+    block_size_t const flag = static_cast<block_size_t>(1) << (std::numeric_limits<block_size_t>::digits - 2);
+    block_size_t &block_size = *reinterpret_cast<block_size_t *>(node);
+    block_size = is_red
+        ? block_size | flag
+        : block_size & ~flag;
+}
+
+inline void *&allocator_red_black_tree::obtain_parent(
+    void *node) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(node) + sizeof(block_size_t) + sizeof(void *));
+}
+
+inline void *&allocator_red_black_tree::obtain_left_subtree(
+    void *node) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(node) + sizeof(block_size_t) + sizeof(void *) * 2);
+}
+
+inline void *&allocator_red_black_tree::obtain_right_subtree(
+    void *node) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(node) + sizeof(block_size_t) + sizeof(void *) * 3);
+}
+
+inline size_t &allocator_red_black_tree::obtain_subtree_max_size(
+    void *node) noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(node) + sizeof(block_size_t) + sizeof(void *) * 4);
+}
+
+inline void *&allocator_red_black_tree::obtain_subtree_lowest_address(
+    void *node) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(node) + sizeof(block_size_t) + sizeof(void *) * 4 + sizeof(size_t));
+}
+
+inline bool allocator_red_black_tree::is_node_less(
+    void *first,
+    void *second) noexcept
+{
+    size_t const first_size = obtain_block_payload_size(first);
+    size_t const second_size = obtain_block_payload_size(second);
+
+    return first_size < second_size || (first_size == second_size && first < second);
+}
+
+void allocator_red_black_tree::update_augmentation(
+    void *node) noexcept
+{
+    size_t max_size = obtain_block_payload_size(node);
+    void *lowest_address = node;
+
+    for (void *subtree: { obtain_left_subtree(node), obtain_right_subtree(node) })
+    {
+        if (subtree == nullptr)
+        {
+            continue;
+        }
+
+        max_size = std::max(max_size, obtain_subtree_max_size(subtree));
+        lowest_address = std::min(lowest_address, obtain_subtree_lowest_address(subtree));
+    }
+
+    obtain_subtree_max_size(node) = max_size;
+    obtain_subtree_lowest_address(node) = lowest_address;
+}
+
+void allocator_red_black_tree::update_augmentation_up_to_root(
+    void *node) noexcept
+{
+    for (; node != nullptr; node = obtain_parent(node))
+    {
+        update_augmentation(node);
+    }
+}
+
+void *&allocator_red_black_tree::obtain_link_to(
+    void *node) const noexcept
+{
+    void *parent = obtain_parent(node);
+
+    if (parent == nullptr)
+    {
+        return obtain_root();
+    }
+
+    return obtain_left_subtree(parent) == node
+        ? obtain_left_subtree(parent)
+        : obtain_right_subtree(parent);
+}
+
+void allocator_red_black_tree::rotate_left(
+    void *node) noexcept
+{
+    void *pivot = obtain_right_subtree(node);
+
+    obtain_right_subtree(node) = obtain_left_subtree(pivot);
+    if (obtain_left_subtree(pivot) != nullptr)
+    {
+        obtain_parent(obtain_left_subtree(pivot)) = node;
+    }
+
+    obtain_link_to(node) = pivot;
+    obtain_parent(pivot) = obtain_parent(node);
+
+    obtain_left_subtree(pivot) = node;
+    obtain_parent(node) = pivot;
+
+    update_augmentation(node);
+    update_augmentation(pivot);
+}
+
+void allocator_red_black_tree::rotate_right(
+    void *node) noexcept
+{
+    void *pivot = obtain_left_subtree(node);
+
+    obtain_left_subtree(node) = obtain_right_subtree(pivot);
+    if (obtain_right_subtree(pivot) != nullptr)
+    {
+        obtain_parent(obtain_right_subtree(pivot)) = node;
+    }
+
+    obtain_link_to(node) = pivot;
+    obtain_parent(pivot) = obtain_parent(node);
+
+    obtain_right_subtree(pivot) = node;
+    obtain_parent(node) = pivot;
+
+    update_augmentation(node);
+    update_augmentation(pivot);
+}
+
+void allocator_red_black_tree::insert_free_block(
+    void *block) noexcept
+{
+    void *parent = nullptr;
+
+    for (void *current = obtain_root(); current != nullptr;)
+    {
+        parent = current;
+        current = is_node_less(block, current)
+            ? obtain_left_subtree(current)
+            : obtain_right_subtree(current);
+    }
+
+    obtain_parent(block) = parent;
+    obtain_left_subtree(block) = nullptr;
+    obtain_right_subtree(block) = nullptr;
+    set_node_red(block, true);
+    update_augmentation(block);
+
+    (parent == nullptr
+        ? obtain_root()
+        : is_node_less(block, parent)
+            ? obtain_left_subtree(parent)
+            : obtain_right_subtree(parent)) = block;
+
+    update_augmentation_up_to_root(parent);
+
+    obtain_statistics_counters().on_free_block_appeared(obtain_block_payload_size(block) + occupied_block_meta_size());
+
+    void *node = block;
+
+    while (is_node_red(obtain_parent(node)))
+    {
+        parent = obtain_parent(node);
+        void *grandparent = obtain_parent(parent);
+        bool const is_parent_left = obtain_left_subtree(grandparent) == parent;
+        void *uncle = is_parent_left
+            ? obtain_right_subtree(grandparent)
+            : obtain_left_subtree(grandparent);
+
+        if (is_node_red(uncle))
+        {
+            set_node_red(parent, false);
+            set_node_red(uncle, false);
+            set_node_red(grandparent, true);
+            node = grandparent;
+
+            continue;
+        }
+
+        if (is_parent_left && obtain_right_subtree(parent) == node)
+        {
+            rotate_left(parent);
+            std::swap(node, parent);
+        }
+        else if (!is_parent_left && obtain_left_subtree(parent) == node)
+        {
+            rotate_right(parent);
+            std::swap(node, parent);
+        }
+
+        set_node_red(parent, false);
+        set_node_red(grandparent, true);
+
+        if (is_parent_left)
+        {
+            rotate_right(grandparent);
+        }
+        else
+        {
+            rotate_left(grandparent);
+        }
+    }
+
+    set_node_red(obtain_root(), false);
+}
+
+void allocator_red_black_tree::remove_free_block(
+    void *block) noexcept
+{
+    obtain_statistics_counters().on_free_block_disappeared(obtain_block_payload_size(block) + occupied_block_meta_size());
+
+    void *replacement;
+    void *replacement_parent;
+    bool is_removed_color_red = is_node_red(block);
+
+    if (obtain_left_subtree(block) == nullptr || obtain_right_subtree(block) == nullptr)
+    {
+        replacement = obtain_left_subtree(block) == nullptr
+            ? obtain_right_subtree(block)
+            : obtain_left_subtree(block);
+        replacement_parent = obtain_parent(block);
+
+        obtain_link_to(block) = replacement;
+        if (replacement != nullptr)
+        {
+            obtain_parent(replacement) = replacement_parent;
+        }
+    }
+    else
+    {
+        void *successor = obtain_right_subtree(block);
+        while (obtain_left_subtree(successor) != nullptr)
+        {
+            successor = obtain_left_subtree(successor);
+        }
+
+        is_removed_color_red = is_node_red(successor);
+        replacement = obtain_right_subtree(successor);
+
+        if (obtain_parent(successor) == block)
+        {
+            replacement_parent = successor;
+        }
+        else
+        {
+            replacement_parent = obtain_parent(successor);
+
+            obtain_left_subtree(replacement_parent) = replacement;
+            if (replacement != nullptr)
+            {
+                obtain_parent(replacement) = replacement_parent;
+            }
+
+            obtain_right_subtree(successor) = obtain_right_subtree(block);
+            obtain_parent(obtain_right_subtree(successor)) = successor;
+        }
+
+        obtain_link_to(block) = successor;
+        obtain_parent(successor) = obtain_parent(block);
+
+        obtain_left_subtree(successor) = obtain_left_subtree(block);
+        obtain_parent(obtain_left_subtree(successor)) = successor;
+
+        set_node_red(successor, is_node_red(block));
+    }
+
+    update_augmentation_up_to_root(replacement_parent);
+
+    if (is_removed_color_red)
+    {
+        return;
+    }
+
+    void *node = replacement;
+    void *parent = replacement_parent;
+
+    while (node != obtain_root() && !is_node_red(node))
+    {
+        bool const is_node_left = obtain_left_subtree(parent) == node;
+        void *sibling = is_node_left
+            ? obtain_right_subtree(parent)
+            : obtain_left_subtree(parent);
+
+        if (is_node_red(sibling))
+        {
+            set_node_red(sibling, false);
+            set_node_red(parent, true);
+
+            if (is_node_left)
+            {
+                rotate_left(parent);
+                sibling = obtain_right_subtree(parent);
+            }
+            else
+            {
+                rotate_right(parent);
+                sibling = obtain_left_subtree(parent);
+            }
+        }
+
+        void *near_nephew = is_node_left
+            ? obtain_left_subtree(sibling)
+            : obtain_right_subtree(sibling);
+        void *far_nephew = is_node_left
+            ? obtain_right_subtree(sibling)
+            : obtain_left_subtree(sibling);
+
+        if (!is_node_red(near_nephew) && !is_node_red(far_nephew))
+        {
+            set_node_red(sibling, true);
+            node = parent;
+            parent = obtain_parent(node);
+
+            continue;
+        }
+
+        if (!is_node_red(far_nephew))
+        {
+            set_node_red(near_nephew, false);
+            set_node_red(sibling, true);
+
+            if (is_node_left)
+            {
+                rotate_right(sibling);
+                sibling = obtain_right_subtree(parent);
+            }
+            else
+            {
+                rotate_left(sibling);
+                sibling = obtain_left_subtree(parent);
+            }
+
+            far_nephew = is_node_left
+                ? obtain_right_subtree(sibling)
+                : obtain_left_subtree(sibling);
+        }
+
+        set_node_red(sibling, is_node_red(parent));
+        set_node_red(parent, false);
+        set_node_red(far_nephew, false);
+
+        if (is_node_left)
+        {
+            rotate_left(parent);
+        }
+        else
+        {
+            rotate_right(parent);
+        }
+
+        node = obtain_root();
+    }
+
+    if (node != nullptr)
+    {
+        set_node_red(node, false);
+    }
+}
+
+void *allocator_red_black_tree::find_best_fit(
+    size_t size) const noexcept
+{
+    void *target = nullptr;
+
+    for (void *node = obtain_root(); node != nullptr;)
+    {
+        if (obtain_block_payload_size(node) >= size)
+        {
+            target = node;
+            node = obtain_left_subtree(node);
+        }
+        else
+        {
+            node = obtain_right_subtree(node);
+        }
+    }
+
+    return target;
+}
+
+void *allocator_red_black_tree::find_worst_fit(
+    size_t size) const noexcept
+{
+    void *node = obtain_root();
+
+    if (node == nullptr || obtain_subtree_max_size(node) < size)
+    {
+        return nullptr;
+    }
+
+    while (obtain_right_subtree(node) != nullptr)
+    {
+        node = obtain_right_subtree(node);
+    }
+
+    return node;
+}
+
+void *allocator_red_black_tree::find_first_fit(
+    size_t size) const noexcept
+{
+    void *target = nullptr;
+
+    for (void *node = obtain_root(); node != nullptr;)
+    {
+        if (obtain_subtree_max_size(node) < size)
+        {
+            break;
+        }
+
+        if (obtain_block_payload_size(node) < size)
+        {
+            node = obtain_right_subtree(node);
+
+            continue;
+        }
+
+        void *candidate = obtain_right_subtree(node) == nullptr
+            ? node
+            : std::min(node, obtain_subtree_lowest_address(obtain_right_subtree(node)));
+
+        if (target == nullptr || candidate < target)
+        {
+            target = candidate;
+        }
+
+        node = obtain_left_subtree(node);
+    }
+
+    return target;
+}
+
+// endregion red-black tree
+
+// region debug checks
+
+void allocator_red_black_tree::verify_block_neighbourhood(
+    void *block,
+    char const *method_signature) const
+{
+    void *corrupted_block = nullptr;
+
+    if (!is_block_intact(block))
+    {
+        corrupted_block = block;
+    }
+    else if (obtain_next_block(block) != obtain_space_end() && obtain_block_payload_size(obtain_next_block(block)) != 0
+        && !is_block_intact(obtain_next_block(block)))
+    {
+        corrupted_block = obtain_next_block(block);
+    }
+    else if (obtain_previous_block(block) != nullptr && !is_block_intact(obtain_previous_block(block)))
+    {
+        corrupted_block = obtain_previous_block(block);
+    }
+
+    if (corrupted_block == nullptr)
+    {
+        return;
+    }
+
+    critical_with_guard(get_typename() + "::" + method_signature + " : memory corruption detected in block at offset "
+        + std::to_string(reinterpret_cast<unsigned char *>(corrupted_block) - reinterpret_cast<unsigned char *>(obtain_first_block())));
+
+    throw std::logic_error("memory corruption detected");
+}
+
+bool allocator_red_black_tree::is_block_intact(
+    void *block) const noexcept
+{
+    void *space_end = obtain_owning_space_end(block);
+
+    if (space_end == nullptr || obtain_next_block(block) > space_end)
+    {
+        return false;
+    }
+
+    if (is_block_occupied(block))
+    {
+        return obtain_block_owner(block) == _trusted_memory
+            && allocator_debug_mode::is_canary_intact(obtain_next_block(block));
+    }
+
+    return obtain_trusted_memory_backing().is_mapped()
+        || allocator_debug_mode::is_poisoned(reinterpret_cast<unsigned char *>(block) + free_block_meta_size(),
+            std::min<size_t>(reinterpret_cast<unsigned char *>(obtain_next_block(block)) - reinterpret_cast<unsigned char *>(block) - free_block_meta_size(),
+                allocator_debug_mode::poison_check_size()));
+}
+
+void allocator_red_black_tree::poison_free_block(
+    void *block) noexcept
+{
+    allocator_debug_mode::poison(reinterpret_cast<unsigned char *>(block) + free_block_meta_size(),
+        reinterpret_cast<unsigned char *>(obtain_next_block(block)) - reinterpret_cast<unsigned char *>(block) - free_block_meta_size());
+}
+
+void allocator_red_black_tree::poison_free_block(
+    void *block,
+    void *freed_block,
+    size_t freed_size) noexcept
+{
+    // the rest of a coalesced block is poisoned already, except for the absorbed next block meta behind the freed bytes
+    auto const payload_begin = reinterpret_cast<uintptr_t>(block) + free_block_meta_size();
+    auto const payload_end = reinterpret_cast<uintptr_t>(obtain_next_block(block));
+    auto const freed_begin = reinterpret_cast<uintptr_t>(freed_block);
+    auto const poisoned_begin = std::max(payload_begin, freed_begin);
+    auto const poisoned_end = std::min(payload_end, freed_begin + freed_size + free_block_meta_size());
+
+    if (poisoned_begin < poisoned_end)
+    {
+        allocator_debug_mode::poison(reinterpret_cast<void *>(poisoned_begin), poisoned_end - poisoned_begin);
+    }
+}
+
+// endregion debug checks
\ No newline at end of file
@@ -1,4 +1,358 @@
 #include <gtest/gtest.h>
+#include <random>
+#include <allocator.h>
+#include <allocator_red_black_tree.h>
+
+size_t round_up_to_max_alignment(
+    size_t size)
+{
+    return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+TEST(positiveTests, test1)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    auto *allocator_with_fit_mode_instance = dynamic_cast<allocator_with_fit_mode *>(allocator_instance);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(1, 100));
+    static_cast<void>(allocator_instance->allocate(1, 32));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(1, 300));
+    static_cast<void>(allocator_instance->allocate(1, 32));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(1, 200));
+    auto *third_separator = reinterpret_cast<unsigned char *>(allocator_instance->allocate(1, 32));
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(second_block);
+    allocator_instance->deallocate(third_block);
+    
+    allocator_with_fit_mode_instance->set_fit_mode(allocator_with_fit_mode::fit_mode::the_best_fit);
+    ASSERT_EQ(allocator_instance->allocate(1, 150), third_block);
+    
+    allocator_with_fit_mode_instance->set_fit_mode(allocator_with_fit_mode::fit_mode::the_worst_fit);
+    ASSERT_EQ(allocator_instance->allocate(1, 50), third_separator
+        + round_up_to_max_alignment(32 + allocator_debug_mode::canary_size() + sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t) * 2));
+    
+    allocator_with_fit_mode_instance->set_fit_mode(allocator_with_fit_mode::fit_mode::first_fit);
+    ASSERT_EQ(allocator_instance->allocate(1, 250), second_block);
+    ASSERT_EQ(allocator_instance->allocate(1, 50), first_block);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test2)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(1 << 20, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    auto *allocator_with_fit_mode_instance = dynamic_cast<allocator_with_fit_mode *>(allocator_instance);
+    
+    std::mt19937 engine(42);
+    std::vector<void *> blocks;
+    
+    for (size_t iteration = 0; iteration < 20000; ++iteration)
+    {
+        allocator_with_fit_mode_instance->set_fit_mode(static_cast<allocator_with_fit_mode::fit_mode>(engine() % 3));
+        
+        if (blocks.empty() || engine() % 3 != 0)
+        {
+            try
+            {
+                blocks.push_back(allocator_instance->allocate(1, 1 + engine() % 1000));
+            }
+            catch (std::bad_alloc const &)
+            {
+                
+            }
+        }
+        else
+        {
+            size_t const index = engine() % blocks.size();
+            allocator_instance->deallocate(blocks[index]);
+            blocks[index] = blocks.back();
+            blocks.pop_back();
+        }
+    }
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].block_size, 1 << 20);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test3)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(1 << 24, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing(trusted_memory_backing::kind::huge_pages, 1 << 16));
+    
+    auto *block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    std::fill(block, block + (1 << 23), 0xAB);
+    allocator_instance->deallocate(block);
+    
+    block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    
+    ASSERT_EQ(block[1 << 22], 0);
+    
+    allocator_instance->deallocate(block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test4)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit);
+    auto *allocator_with_statistics_instance = dynamic_cast<allocator_with_statistics *>(allocator_instance);
+    
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < 64; ++i)
+    {
+        blocks.push_back(allocator_instance->allocate(sizeof(unsigned char), 256));
+    }
+    
+    for (size_t i = 0; i < blocks.size(); i += 2)
+    {
+        allocator_instance->deallocate(blocks[i]);
+    }
+    
+    auto statistics = allocator_with_statistics_instance->get_statistics();
+    
+    ASSERT_EQ(statistics.allocations_count, 64);
+    ASSERT_EQ(statistics.deallocations_count, 32);
+    ASSERT_EQ(statistics.allocate_latency.total_count(), 0);
+    ASSERT_EQ(statistics.deallocate_latency.total_count(), 0);
+    ASSERT_EQ(statistics.free_blocks_count, 33);
+    ASSERT_EQ(statistics.bytes_in_use + statistics.bytes_free, 1 << 16);
+    ASSERT_GT(statistics.external_fragmentation, 0.0);
+    
+    allocator_with_statistics_instance->set_latency_sampling_period(4);
+    
+    for (size_t i = 1; i < blocks.size(); i += 2)
+    {
+        allocator_instance->deallocate(blocks[i]);
+    }
+    
+    statistics = allocator_with_statistics_instance->get_statistics();
+    
+    ASSERT_EQ(statistics.bytes_in_use, 0);
+    ASSERT_EQ(statistics.free_blocks_count, 1);
+    ASSERT_EQ(statistics.largest_free_block_size, 1 << 16);
+    ASSERT_EQ(statistics.external_fragmentation, 0.0);
+    ASSERT_EQ(statistics.deallocate_latency.total_count(), 8);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test5)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    
+    allocator_instance->deallocate(second_block);
+    
+    ASSERT_TRUE(allocator_instance->try_expand_in_place(first_block, sizeof(unsigned char), 200));
+    ASSERT_FALSE(allocator_instance->try_expand_in_place(first_block, sizeof(unsigned char), 300));
+    
+    void *fourth_block = allocator_instance->allocate(sizeof(unsigned char), 200);
+    
+    ASSERT_EQ(allocator_instance->reallocate(fourth_block, sizeof(unsigned char), 200, 3000), fourth_block);
+    
+    allocator_instance->deallocate(third_block);
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(fourth_block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test6)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 100, alignment);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignment, 0);
+        
+        std::fill(reinterpret_cast<unsigned char *>(block), reinterpret_cast<unsigned char *>(block) + 100, 0xCD);
+        blocks.push_back(block);
+    }
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 100, 48)), std::logic_error);
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test7)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(1024, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        trusted_memory_backing(), allocator_growth_policy(4096, 3));
+    auto *allocator_test_utils_instance = dynamic_cast<allocator_test_utils *>(allocator_instance);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 2000);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 1100);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 8000);
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 8000)), std::bad_alloc);
+    
+    auto segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 3);
+    ASSERT_EQ(segments_blocks_info[0].size(), 1);
+    ASSERT_EQ(segments_blocks_info[1].size(), 3);
+    ASSERT_EQ(segments_blocks_info[2].size(), 1);
+    ASSERT_EQ(segments_blocks_info[2][0].block_size, round_up_to_max_alignment(8000 + allocator_debug_mode::canary_size()
+        + sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t) * 2));
+    
+    auto statistics = dynamic_cast<allocator_with_statistics *>(allocator_instance)->get_statistics();
+    
+    ASSERT_EQ(statistics.bytes_in_use + statistics.bytes_free, 1024 + 4096 + segments_blocks_info[2][0].block_size);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(third_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 2);
+    ASSERT_EQ(segments_blocks_info[1].size(), 3);
+    
+    allocator_instance->deallocate(second_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 1);
+    ASSERT_EQ(allocator_test_utils_instance->get_blocks_info(), segments_blocks_info[0]);
+    
+    delete allocator_instance;
+}
+
+TEST(positiveTests, test8)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t size = 1; size <= 50; size += 7)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), size);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t), 0);
+        
+        blocks.push_back(block);
+    }
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test1)
+{
+    allocator *allocator_instance = new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(char), 3000)), std::bad_alloc);
+    
+    void *block = allocator_instance->allocate(sizeof(char), 100);
+    allocator *another_allocator_instance = new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    ASSERT_THROW(another_allocator_instance->deallocate(block), std::logic_error);
+    
+    allocator_instance->deallocate(block);
+    
+    delete another_allocator_instance;
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test2)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    std::fill(first_block, second_block, 0xCD);
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test3)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    std::fill(second_block, third_block, 0xCD);
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(falsePositiveTests, test4)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    allocator_instance->deallocate(second_block);
+    second_block[32] = 0xCD;
+    
+    ASSERT_THROW(allocator_instance->deallocate(third_block), std::logic_error);
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
 
 int main(
     int argc,
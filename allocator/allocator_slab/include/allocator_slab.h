@@ -0,0 +1,210 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_SLAB_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_SLAB_H
+
+#include <allocator_address_directory.h>
+#include <allocator_guardant.h>
+#include <allocator_test_utils.h>
+#include <allocator_with_statistics.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_slab final:
+    private allocator_guardant,
+    public allocator,
+    public allocator_test_utils,
+    public allocator_with_statistics,
+    private logger_guardant,
+    private typename_holder
+{
+
+private:
+    
+    struct size_class_slabs
+    {
+        
+        void *first_partial_slab;
+        
+        void *first_full_slab;
+        
+        void *first_empty_slab;
+        
+        size_t empty_slabs_count;
+        
+    };
+
+private:
+    
+    void *_trusted_memory;
+
+public:
+    
+    ~allocator_slab() override;
+    
+    allocator_slab(
+        allocator_slab const &other) = delete;
+    
+    allocator_slab &operator=(
+        allocator_slab const &other) = delete;
+    
+    allocator_slab(
+        allocator_slab &&other) noexcept;
+    
+    allocator_slab &operator=(
+        allocator_slab &&other) noexcept;
+
+public:
+    
+    explicit allocator_slab(
+        size_t slab_size = 1 << 16,
+        allocator *parent_allocator = nullptr,
+        logger *logger = nullptr,
+        size_t empty_slabs_per_size_class = 1);
+
+public:
+    
+    using allocator::allocate;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    void deallocate(
+        void *at) override;
+    
+    bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count) override;
+
+public:
+    
+    static constexpr size_t min_size_class() noexcept;
+    
+    static constexpr size_t max_size_class() noexcept;
+
+public:
+    
+    std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+    
+    std::vector<std::vector<allocator_test_utils::block_info>> get_segments_blocks_info() const noexcept override;
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t size_classes_count() noexcept;
+    
+    static constexpr size_t slab_meta_size() noexcept;
+    
+    inline size_t obtain_slab_size() const noexcept;
+    
+    inline size_t obtain_empty_slabs_limit() const noexcept;
+    
+    inline void **&obtain_slabs() const noexcept;
+    
+    inline size_t &obtain_slabs_count() const noexcept;
+    
+    inline size_t &obtain_slabs_capacity() const noexcept;
+    
+    inline size_class_slabs &obtain_size_class_slabs(
+        size_t size_class_index) const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    static inline size_t &obtain_slab_object_size(
+        void *slab) noexcept;
+    
+    static inline size_t &obtain_slab_space_size(
+        void *slab) noexcept;
+    
+    static inline size_t &obtain_slab_occupied_objects_count(
+        void *slab) noexcept;
+    
+    static inline void *&obtain_slab_first_free_object(
+        void *slab) noexcept;
+    
+    static inline void *&obtain_previous_slab(
+        void *slab) noexcept;
+    
+    static inline void *&obtain_next_slab(
+        void *slab) noexcept;
+    
+    static inline void *obtain_slab_first_object(
+        void *slab) noexcept;
+    
+    static inline size_t obtain_slab_objects_count(
+        void *slab) noexcept;
+    
+    static inline void *&obtain_next_free_object(
+        void *object) noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region size classes
+    
+    static size_t obtain_size_class_index(
+        size_t size) noexcept;
+    
+    static inline bool is_large_slab(
+        void *slab) noexcept;
+    
+    static void unlink_slab(
+        void *&first_slab,
+        void *slab) noexcept;
+    
+    static void push_slab(
+        void *&first_slab,
+        void *slab) noexcept;
+    
+    // endregion size classes
+    
+    // region slabs directory
+    
+    void *create_slab(
+        size_t object_size,
+        size_t space_size);
+    
+    void release_slab(
+        void *slab);
+    
+    void release_slabs() noexcept;
+    
+    void *find_owning_slab(
+        void *at) const noexcept;
+    
+    // endregion slabs directory
+    
+};
+
+constexpr size_t allocator_slab::min_size_class() noexcept
+{
+    return 8;
+}
+
+constexpr size_t allocator_slab::max_size_class() noexcept
+{
+    return 4096;
+}
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_SLAB_H
\ No newline at end of file
@@ -0,0 +1,598 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "../include/allocator_slab.h"
+
+allocator_slab::~allocator_slab()
+{
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard(get_typename() + "::~allocator_slab() : called");
+    release_slabs();
+    deallocate_with_guard(_trusted_memory);
+}
+
+allocator_slab::allocator_slab(
+    allocator_slab &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
+{
+    other._trusted_memory = nullptr;
+}
+
+allocator_slab &allocator_slab::operator=(
+    allocator_slab &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_slabs();
+            deallocate_with_guard(_trusted_memory);
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
+}
+
+allocator_slab::allocator_slab(
+    size_t slab_size,
+    allocator *parent_allocator,
+    logger *logger,
+    size_t empty_slabs_per_size_class)
+{
+    if (slab_size < slab_meta_size() + max_size_class())
+    {
+        throw std::logic_error("slab size must fit an object of the largest size class");
+    }
+
+    _trusted_memory = parent_allocator == nullptr
+        ? ::operator new(meta_size())
+        : parent_allocator->allocate(1, meta_size());
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<size_t *>(memory) = slab_size;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = empty_slabs_per_size_class;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<void ***>(memory) = nullptr;
+    memory += sizeof(void **);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<size_t *>(memory) = 0;
+
+    for (size_t i = 0; i < size_classes_count(); ++i)
+    {
+        size_class_slabs &slabs = obtain_size_class_slabs(i);
+        slabs.first_partial_slab = nullptr;
+        slabs.first_full_slab = nullptr;
+        slabs.first_empty_slab = nullptr;
+        slabs.empty_slabs_count = 0;
+    }
+
+    obtain_statistics_counters().reset();
+
+    debug_with_guard(get_typename() + "::allocator_slab(size_t, allocator *, logger *, size_t) : "
+        + "slab allocator with " + std::to_string(slab_size) + " byte slabs constructed");
+}
+
+[[nodiscard]] void *allocator_slab::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() - slab_meta_size()) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_size = std::max(value_size * values_count, min_size_class());
+    void *slab;
+
+    if (requested_size > max_size_class())
+    {
+        slab = create_slab(requested_size, slab_meta_size() + requested_size);
+    }
+    else
+    {
+        size_class_slabs &slabs = obtain_size_class_slabs(obtain_size_class_index(requested_size));
+        slab = slabs.first_partial_slab;
+
+        if (slab == nullptr)
+        {
+            if (slabs.first_empty_slab != nullptr)
+            {
+                slab = slabs.first_empty_slab;
+                unlink_slab(slabs.first_empty_slab, slab);
+                --slabs.empty_slabs_count;
+            }
+            else
+            {
+                slab = create_slab(min_size_class() << obtain_size_class_index(requested_size), obtain_slab_size());
+            }
+
+            push_slab(slabs.first_partial_slab, slab);
+        }
+
+        if (obtain_slab_occupied_objects_count(slab) + 1 == obtain_slab_objects_count(slab))
+        {
+            unlink_slab(slabs.first_partial_slab, slab);
+            push_slab(slabs.first_full_slab, slab);
+        }
+    }
+
+    void *object = obtain_slab_first_free_object(slab);
+    obtain_slab_first_free_object(slab) = obtain_next_free_object(object);
+    ++obtain_slab_occupied_objects_count(slab);
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.allocations_count;
+    --counters.free_blocks_count;
+    counters.bytes_in_use += obtain_slab_object_size(slab);
+
+    return object;
+}
+
+void allocator_slab::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+    void *slab = find_owning_slab(at);
+
+    if (slab == nullptr
+        || (reinterpret_cast<uintptr_t>(at) - reinterpret_cast<uintptr_t>(obtain_slab_first_object(slab))) % obtain_slab_object_size(slab) != 0)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    bool const was_slab_full = obtain_slab_occupied_objects_count(slab) == obtain_slab_objects_count(slab);
+
+    obtain_next_free_object(at) = obtain_slab_first_free_object(slab);
+    obtain_slab_first_free_object(slab) = at;
+    --obtain_slab_occupied_objects_count(slab);
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.deallocations_count;
+    ++counters.free_blocks_count;
+    counters.bytes_in_use -= obtain_slab_object_size(slab);
+
+    if (is_large_slab(slab))
+    {
+        release_slab(slab);
+
+        return;
+    }
+
+    size_class_slabs &slabs = obtain_size_class_slabs(obtain_size_class_index(obtain_slab_object_size(slab)));
+
+    if (obtain_slab_occupied_objects_count(slab) != 0)
+    {
+        if (was_slab_full)
+        {
+            unlink_slab(slabs.first_full_slab, slab);
+            push_slab(slabs.first_partial_slab, slab);
+        }
+
+        return;
+    }
+
+    unlink_slab(was_slab_full
+        ? slabs.first_full_slab
+        : slabs.first_partial_slab, slab);
+
+    if (slabs.empty_slabs_count == obtain_empty_slabs_limit())
+    {
+        release_slab(slab);
+
+        return;
+    }
+
+    push_slab(slabs.first_empty_slab, slab);
+    ++slabs.empty_slabs_count;
+}
+
+bool allocator_slab::try_expand_in_place(
+    void *at,
+    size_t value_size,
+    size_t values_count)
+{
+    void *slab = find_owning_slab(at);
+
+    if (slab == nullptr)
+    {
+        error_with_guard(get_typename() + "::try_expand_in_place(void *, size_t, size_t) : attempt to expand block not owned by allocator");
+
+        throw std::logic_error("attempt to expand block not owned by allocator");
+    }
+
+    size_t const object_size = obtain_slab_object_size(slab);
+
+    return values_count == 0 || value_size <= object_size / values_count;
+}
+
+std::vector<allocator_test_utils::block_info> allocator_slab::get_blocks_info() const noexcept
+{
+    std::vector<allocator_test_utils::block_info> blocks_info;
+
+    for (auto const &segment_blocks_info: get_segments_blocks_info())
+    {
+        blocks_info.insert(blocks_info.end(), segment_blocks_info.begin(), segment_blocks_info.end());
+    }
+
+    return blocks_info;
+}
+
+std::vector<std::vector<allocator_test_utils::block_info>> allocator_slab::get_segments_blocks_info() const noexcept
+{
+    std::vector<std::vector<allocator_test_utils::block_info>> segments_blocks_info;
+    void **slabs = obtain_slabs();
+
+    for (size_t i = 0; i < obtain_slabs_count(); ++i)
+    {
+        void *slab = slabs[i];
+        size_t const object_size = obtain_slab_object_size(slab);
+        auto const *first_object = reinterpret_cast<unsigned char *>(obtain_slab_first_object(slab));
+        std::vector<bool> is_object_free(obtain_slab_objects_count(slab), false);
+
+        for (void *object = obtain_slab_first_free_object(slab); object != nullptr; object = obtain_next_free_object(object))
+        {
+            is_object_free[(reinterpret_cast<unsigned char *>(object) - first_object) / object_size] = true;
+        }
+
+        segments_blocks_info.emplace_back();
+
+        for (bool is_free: is_object_free)
+        {
+            segments_blocks_info.back().push_back({ object_size, !is_free });
+        }
+    }
+
+    return segments_blocks_info;
+}
+
+allocator_with_statistics::statistics allocator_slab::get_statistics() const noexcept
+{
+    allocator_with_statistics::statistics_counters const &counters = obtain_statistics_counters();
+    void **slabs = obtain_slabs();
+    size_t space_size = 0;
+    size_t largest_free_block_size = 0;
+
+    for (size_t i = 0; i < obtain_slabs_count(); ++i)
+    {
+        space_size += obtain_slab_objects_count(slabs[i]) * obtain_slab_object_size(slabs[i]);
+    }
+
+    for (size_t i = 0; i < size_classes_count(); ++i)
+    {
+        size_class_slabs const &size_class = obtain_size_class_slabs(i);
+
+        if (size_class.first_partial_slab != nullptr || size_class.first_empty_slab != nullptr)
+        {
+            largest_free_block_size = min_size_class() << i;
+        }
+    }
+
+    return collect_statistics(counters, space_size, largest_free_block_size);
+}
+
+void allocator_slab::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
+}
+
+inline allocator *allocator_slab::get_allocator() const
+{
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+inline logger *allocator_slab::get_logger() const
+{
+    return *reinterpret_cast<logger **>(_trusted_memory);
+}
+
+inline std::string allocator_slab::get_typename() const noexcept
+{
+    return "allocator_slab";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_slab::meta_size() noexcept
+{
+    return sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 4 + sizeof(void **)
+        + sizeof(size_class_slabs) * size_classes_count() + sizeof(allocator_with_statistics::statistics_counters);
+}
+
+constexpr size_t allocator_slab::size_classes_count() noexcept
+{
+    return 10;
+}
+
+constexpr size_t allocator_slab::slab_meta_size() noexcept
+{
+    return sizeof(size_t) * 3 + sizeof(void *) * 3;
+}
+
+inline size_t allocator_slab::obtain_slab_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline size_t allocator_slab::obtain_empty_slabs_limit() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t));
+}
+
+inline void **&allocator_slab::obtain_slabs() const noexcept
+{
+    return *reinterpret_cast<void ***>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 2);
+}
+
+inline size_t &allocator_slab::obtain_slabs_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 2 + sizeof(void **));
+}
+
+inline size_t &allocator_slab::obtain_slabs_capacity() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 3 + sizeof(void **));
+}
+
+inline allocator_slab::size_class_slabs &allocator_slab::obtain_size_class_slabs(
+    size_t size_class_index) const noexcept
+{
+    return reinterpret_cast<size_class_slabs *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 4 + sizeof(void **))[size_class_index];
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_slab::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) * 4 + sizeof(void **)
+        + sizeof(size_class_slabs) * size_classes_count());
+}
+
+inline size_t &allocator_slab::obtain_slab_object_size(
+    void *slab) noexcept
+{
+    return *reinterpret_cast<size_t *>(slab);
+}
+
+inline size_t &allocator_slab::obtain_slab_space_size(
+    void *slab) noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(slab) + sizeof(size_t));
+}
+
+inline size_t &allocator_slab::obtain_slab_occupied_objects_count(
+    void *slab) noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(slab) + sizeof(size_t) * 2);
+}
+
+inline void *&allocator_slab::obtain_slab_first_free_object(
+    void *slab) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(slab) + sizeof(size_t) * 3);
+}
+
+inline void *&allocator_slab::obtain_previous_slab(
+    void *slab) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(slab) + sizeof(size_t) * 3 + sizeof(void *));
+}
+
+inline void *&allocator_slab::obtain_next_slab(
+    void *slab) noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(slab) + sizeof(size_t) * 3 + sizeof(void *) * 2);
+}
+
+inline void *allocator_slab::obtain_slab_first_object(
+    void *slab) noexcept
+{
+    return reinterpret_cast<unsigned char *>(slab) + slab_meta_size();
+}
+
+inline size_t allocator_slab::obtain_slab_objects_count(
+    void *slab) noexcept
+{
+    return (obtain_slab_space_size(slab) - slab_meta_size()) / obtain_slab_object_size(slab);
+}
+
+inline void *&allocator_slab::obtain_next_free_object(
+    void *object) noexcept
+{
+    return *reinterpret_cast<void **>(object);
+}
+
+// endregion trusted memory layout
+
+// region size classes
+
+size_t allocator_slab::obtain_size_class_index(
+    size_t size) noexcept
+{
+    size_t size_class_index = 0;
+
+    while ((min_size_class() << size_class_index) < size)
+    {
+        ++size_class_index;
+    }
+
+    return size_class_index;
+}
+
+inline bool allocator_slab::is_large_slab(
+    void *slab) noexcept
+{
+    return obtain_slab_object_size(slab) > max_size_class();
+}
+
+void allocator_slab::unlink_slab(
+    void *&first_slab,
+    void *slab) noexcept
+{
+    void *previous_slab = obtain_previous_slab(slab);
+    void *next_slab = obtain_next_slab(slab);
+
+    if (previous_slab == nullptr)
+    {
+        first_slab = next_slab;
+    }
+    else
+    {
+        obtain_next_slab(previous_slab) = next_slab;
+    }
+
+    if (next_slab != nullptr)
+    {
+        obtain_previous_slab(next_slab) = previous_slab;
+    }
+}
+
+void allocator_slab::push_slab(
+    void *&first_slab,
+    void *slab) noexcept
+{
+    obtain_previous_slab(slab) = nullptr;
+    obtain_next_slab(slab) = first_slab;
+
+    if (first_slab != nullptr)
+    {
+        obtain_previous_slab(first_slab) = slab;
+    }
+
+    first_slab = slab;
+}
+
+// endregion size classes
+
+// region slabs directory
+
+void *allocator_slab::create_slab(
+    size_t object_size,
+    size_t space_size)
+{
+    void *slab = allocate_with_guard(1, space_size);
+
+    try
+    {
+        allocator_address_directory::insert(obtain_slabs(), obtain_slabs_count(), obtain_slabs_capacity(), slab, *this);
+    }
+    catch (...)
+    {
+        deallocate_with_guard(slab);
+
+        throw;
+    }
+
+    obtain_slab_object_size(slab) = object_size;
+    obtain_slab_space_size(slab) = space_size;
+    obtain_slab_occupied_objects_count(slab) = 0;
+    obtain_slab_first_free_object(slab) = nullptr;
+    obtain_previous_slab(slab) = nullptr;
+    obtain_next_slab(slab) = nullptr;
+
+    size_t const objects_count = obtain_slab_objects_count(slab);
+    auto *object = reinterpret_cast<unsigned char *>(obtain_slab_first_object(slab)) + object_size * objects_count;
+
+    for (size_t i = 0; i < objects_count; ++i)
+    {
+        object -= object_size;
+        obtain_next_free_object(object) = obtain_slab_first_free_object(slab);
+        obtain_slab_first_free_object(slab) = object;
+    }
+
+    obtain_statistics_counters().free_blocks_count += objects_count;
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::create_slab(size_t, size_t) : slab of " + std::to_string(objects_count) + " "
+            + std::to_string(object_size) + " byte objects allocated";
+    });
+
+    return slab;
+}
+
+void allocator_slab::release_slab(
+    void *slab)
+{
+    obtain_statistics_counters().free_blocks_count -= obtain_slab_objects_count(slab) - obtain_slab_occupied_objects_count(slab);
+    allocator_address_directory::remove(obtain_slabs(), obtain_slabs_count(), slab);
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::release_slab(void *) : slab of " + std::to_string(obtain_slab_object_size(slab))
+            + " byte objects released";
+    });
+
+    deallocate_with_guard(slab);
+}
+
+void allocator_slab::release_slabs() noexcept
+{
+    void **slabs = obtain_slabs();
+
+    for (size_t i = 0; i < obtain_slabs_count(); ++i)
+    {
+        deallocate_with_guard(slabs[i]);
+    }
+
+    allocator_address_directory::release(obtain_slabs(), obtain_slabs_count(), obtain_slabs_capacity(), *this);
+}
+
+void *allocator_slab::find_owning_slab(
+    void *at) const noexcept
+{
+    void *slab = allocator_address_directory::find_preceding(obtain_slabs(), obtain_slabs_count(), at);
+
+    if (slab == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto const address = reinterpret_cast<uintptr_t>(at);
+
+    return address < reinterpret_cast<uintptr_t>(obtain_slab_first_object(slab))
+        || address >= reinterpret_cast<uintptr_t>(slab) + obtain_slab_space_size(slab)
+        ? nullptr
+        : slab;
+}
+
+// endregion slabs directory
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <allocator_slab.h>
+#include <allocator_sorted_list.h>
+
+TEST(allocatorSlabPositiveTests, test1)
+{
+    allocator *parent_allocator = new allocator_sorted_list(1 << 23, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    allocator *subject = new allocator_slab(1 << 14, parent_allocator);
+    
+    std::vector<std::pair<unsigned char *, size_t>> blocks;
+    for (size_t i = 0; i < 300; ++i)
+    {
+        size_t const size = 1 + (i * 37) % 6000;
+        auto *block = reinterpret_cast<unsigned char *>(subject->allocate(sizeof(unsigned char), size));
+        std::fill(block, block + size, static_cast<unsigned char>(i));
+        blocks.emplace_back(block, size);
+    }
+    
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        ASSERT_TRUE(std::all_of(blocks[i].first, blocks[i].first + blocks[i].second,
+            [i](unsigned char value) { return value == static_cast<unsigned char>(i); }));
+    }
+    
+    for (size_t i = 0; i < blocks.size(); i += 2)
+    {
+        subject->deallocate(blocks[i].first);
+    }
+    
+    for (size_t i = 1; i < blocks.size(); i += 2)
+    {
+        subject->deallocate(blocks[i].first);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(subject)->get_blocks_info();
+    
+    ASSERT_TRUE(std::none_of(actual_blocks_state.begin(), actual_blocks_state.end(),
+        [](allocator_test_utils::block_info const &block_info) { return block_info.is_block_occupied; }));
+    
+    delete subject;
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(parent_allocator)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete parent_allocator;
+}
+
+TEST(allocatorSlabPositiveTests, test2)
+{
+    allocator_slab subject(1024 * 4 + 64, nullptr, nullptr, 0);
+    
+    void *first_block = subject.allocate(sizeof(unsigned char), 1000);
+    void *second_block = subject.allocate(sizeof(unsigned char), 1000);
+    void *third_block = subject.allocate(sizeof(unsigned char), 1000);
+    void *fourth_block = subject.allocate(sizeof(unsigned char), 1000);
+    void *fifth_block = subject.allocate(sizeof(unsigned char), 1000);
+    
+    auto segments_blocks_info = subject.get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 2);
+    ASSERT_EQ(segments_blocks_info[0].size() + segments_blocks_info[1].size(), 8);
+    ASSERT_EQ(segments_blocks_info[0][0].block_size, 1024);
+    
+    subject.deallocate(second_block);
+    
+    ASSERT_EQ(subject.allocate(sizeof(unsigned char), 1024), second_block);
+    ASSERT_TRUE(subject.try_expand_in_place(first_block, sizeof(unsigned char), 1024));
+    ASSERT_FALSE(subject.try_expand_in_place(first_block, sizeof(unsigned char), 1025));
+    
+    subject.deallocate(fifth_block);
+    
+    ASSERT_EQ(subject.get_segments_blocks_info().size(), 1);
+    
+    auto statistics = subject.get_statistics();
+    
+    ASSERT_EQ(statistics.allocations_count, 6);
+    ASSERT_EQ(statistics.deallocations_count, 2);
+    ASSERT_EQ(statistics.bytes_in_use, 4 * 1024);
+    ASSERT_EQ(statistics.free_blocks_count, 0);
+    
+    subject.deallocate(first_block);
+    subject.deallocate(second_block);
+    subject.deallocate(third_block);
+    subject.deallocate(fourth_block);
+    
+    ASSERT_TRUE(subject.get_blocks_info().empty());
+}
+
+TEST(allocatorSlabPositiveTests, test3)
+{
+    allocator_slab subject;
+    
+    void *large_block = subject.allocate(sizeof(int), 10000);
+    void *small_block = subject.allocate(sizeof(char), 3);
+    
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(small_block) % allocator_slab::min_size_class(), 0);
+    
+    auto segments_blocks_info = subject.get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 2);
+    
+    subject.deallocate(large_block);
+    segments_blocks_info = subject.get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 1);
+    ASSERT_EQ(segments_blocks_info[0][0].block_size, allocator_slab::min_size_class());
+    ASSERT_TRUE(segments_blocks_info[0][0].is_block_occupied);
+    
+    subject.deallocate(small_block);
+    
+    ASSERT_EQ(subject.get_segments_blocks_info().size(), 1);
+}
+
+TEST(allocatorSlabNegativeTests, test1)
+{
+    ASSERT_THROW(allocator_slab(1024), std::logic_error);
+    
+    allocator_slab subject;
+    allocator_slab another_subject;
+    
+    auto *block = reinterpret_cast<unsigned char *>(subject.allocate(sizeof(char), 100));
+    int foreign_value = 0;
+    
+    ASSERT_THROW(another_subject.deallocate(block), std::logic_error);
+    ASSERT_THROW(subject.deallocate(&foreign_value), std::logic_error);
+    ASSERT_THROW(subject.deallocate(block + 1), std::logic_error);
+    ASSERT_THROW(static_cast<void>(subject.allocate(std::numeric_limits<size_t>::max(), 2)), std::bad_alloc);
+    
+    subject.deallocate(block);
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -1,20 +1,38 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_SORTED_LIST_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_SORTED_LIST_H
 
+#include <allocator_debug_mode.h>
+#include <allocator_growth_policy.h>
 #include <allocator_guardant.h>
 #include <allocator_test_utils.h>
+#include <allocator_with_compaction.h>
 #include <allocator_with_fit_mode.h>
+#include <allocator_with_statistics.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <trusted_memory_backing.h>
 
 class allocator_sorted_list final:
     private allocator_guardant,
     public allocator_test_utils,
+    public allocator_with_compaction,
     public allocator_with_fit_mode,
+    public allocator_with_statistics,
     private logger_guardant,
     private typename_holder
 {
 
+private:
+    
+    struct front_cache_entry
+    {
+        
+        block_size_t block_size;
+        
+        block_pointer_t first_block;
+        
+    };
+
 private:
     
     void *_trusted_memory;
@@ -24,10 +42,10 @@ public:
     ~allocator_sorted_list() override;
     
     allocator_sorted_list(
-        allocator_sorted_list const &other);
+        allocator_sorted_list const &other) = delete;
     
     allocator_sorted_list &operator=(
-        allocator_sorted_list const &other);
+        allocator_sorted_list const &other) = delete;
     
     allocator_sorted_list(
         allocator_sorted_list &&other) noexcept;
@@ -41,7 +59,10 @@ public:
         size_t space_size,
         allocator *parent_allocator = nullptr,
         logger *logger = nullptr,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+        allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+        std::vector<size_t> const &front_cache_size_classes = std::vector<size_t>(),
+        trusted_memory_backing const &backing = trusted_memory_backing(),
+        allocator_growth_policy const &growth_policy = allocator_growth_policy());
 
 public:
     
@@ -49,8 +70,45 @@ public:
         size_t value_size,
         size_t values_count) override;
     
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
     void deallocate(
         void *at) override;
+    
+    void allocate_batch(
+        size_t block_size,
+        size_t blocks_count,
+        void **blocks) override;
+    
+    void deallocate_batch(
+        void **blocks,
+        size_t blocks_count) override;
+    
+    bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count) override;
+
+public:
+    
+    [[nodiscard]] allocator_with_compaction::handle_t allocate_relocatable(
+        size_t value_size,
+        size_t values_count) override;
+    
+    void deallocate_relocatable(
+        allocator_with_compaction::handle_t handle) override;
+    
+    [[nodiscard]] void *lock(
+        allocator_with_compaction::handle_t handle) override;
+    
+    void unlock(
+        allocator_with_compaction::handle_t handle) override;
+    
+    size_t compact(
+        size_t max_relocations_count = std::numeric_limits<size_t>::max()) override;
 
 public:
     
@@ -64,6 +122,15 @@ private:
 public:
     
     std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+    
+    std::vector<std::vector<allocator_test_utils::block_info>> get_segments_blocks_info() const noexcept override;
+
+public:
+    
+    allocator_with_statistics::statistics get_statistics() const noexcept override;
+    
+    void set_latency_sampling_period(
+        size_t period) noexcept override;
 
 private:
     
@@ -72,6 +139,145 @@ private:
 private:
     
     inline std::string get_typename() const noexcept override;
+
+private:
+    
+    // region trusted memory layout
+    
+    static constexpr size_t meta_size() noexcept;
+    
+    static constexpr size_t block_meta_size() noexcept;
+    
+    static constexpr size_t segment_meta_size() noexcept;
+    
+    inline allocator_with_fit_mode::fit_mode &obtain_fit_mode() const noexcept;
+    
+    inline size_t obtain_space_size() const noexcept;
+    
+    inline void *&obtain_first_free_block() const noexcept;
+    
+    inline size_t obtain_front_cache_size() const noexcept;
+    
+    inline front_cache_entry *obtain_front_cache() const noexcept;
+    
+    inline void *obtain_first_block() const noexcept;
+    
+    inline void *obtain_space_end() const noexcept;
+    
+    inline trusted_memory_backing &obtain_trusted_memory_backing() const noexcept;
+    
+    inline allocator_growth_policy &obtain_growth_policy() const noexcept;
+    
+    inline void *&obtain_last_segment() const noexcept;
+    
+    inline size_t &obtain_segments_count() const noexcept;
+    
+    inline allocator_with_statistics::statistics_counters &obtain_statistics_counters() const noexcept;
+    
+    inline allocator_with_compaction::handles_table *&obtain_handles_table() const noexcept;
+    
+    void release_trusted_memory();
+    
+    static inline block_size_t &obtain_block_size(
+        void *block) noexcept;
+    
+    static inline block_pointer_t &obtain_block_pointer(
+        void *block) noexcept;
+    
+    static inline void *obtain_next_block(
+        void *block) noexcept;
+    
+    static inline void *&obtain_previous_segment(
+        void *segment) noexcept;
+    
+    static inline size_t &obtain_segment_space_size(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_first_block(
+        void *segment) noexcept;
+    
+    static inline void *obtain_segment_space_end(
+        void *segment) noexcept;
+    
+    // endregion trusted memory layout
+    
+    // region segments manipulation
+    
+    bool is_owned_block_address(
+        void *block) const noexcept;
+    
+    void *obtain_owning_space_end(
+        void *block) const noexcept;
+    
+    bool try_grow(
+        block_size_t requested_size);
+    
+    bool try_release_segment(
+        void *block) noexcept;
+    
+    // endregion segments manipulation
+    
+    // region free list manipulation
+    
+    void *allocate_from_free_list(
+        block_size_t requested_size,
+        size_t alignment);
+    
+    static block_size_t obtain_leading_fragment_size(
+        void *block,
+        size_t alignment) noexcept;
+    
+    void *insert_to_free_list(
+        void *block,
+        void *previous_free_block_hint = nullptr) noexcept;
+    
+    void remove_from_free_list(
+        void *block) noexcept;
+    
+    // rescans the free list and the front cache only after the last block of the largest size has gone
+    void refresh_largest_free_block_size() noexcept;
+    
+    // endregion free list manipulation
+    
+    // region front cache manipulation
+    
+    front_cache_entry *find_front_cache_entry(
+        block_size_t requested_size) const noexcept;
+    
+    void flush_front_cache() noexcept;
+    
+    // endregion front cache manipulation
+    
+    // region debug checks
+    
+    void verify_block_neighbourhood(
+        void *block,
+        char const *method_signature) const;
+    
+    bool is_block_intact(
+        void *block) const noexcept;
+    
+    static void poison_free_block(
+        void *block) noexcept;
+    
+    static void poison_free_block(
+        void *block,
+        void *freed_block,
+        size_t freed_size) noexcept;
+    
+    // endregion debug checks
+    
+    // region compaction
+    
+    allocator_with_compaction::handles_table &obtain_valid_handles_table(
+        allocator_with_compaction::handle_t handle,
+        char const *method_signature) const;
+    
+    void *relocate_next_block(
+        void *free_block,
+        void *previous_free_block);
+    
+    // endregion compaction
     
 };
 
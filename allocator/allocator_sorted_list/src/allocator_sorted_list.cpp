@@ -1,80 +1,1392 @@
-#include <not_implemented.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <unordered_set>
+#include <utility>
 
 #include "../include/allocator_sorted_list.h"
 
 allocator_sorted_list::~allocator_sorted_list()
 {
-    throw not_implemented("allocator_sorted_list::~allocator_sorted_list()", "your code should be here...");
-}
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
 
-allocator_sorted_list::allocator_sorted_list(
-    allocator_sorted_list const &other)
-{
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(allocator_sorted_list const &)", "your code should be here...");
-}
-
-allocator_sorted_list &allocator_sorted_list::operator=(
-    allocator_sorted_list const &other)
-{
-    throw not_implemented("allocator_sorted_list &allocator_sorted_list::operator=(allocator_sorted_list const &)", "your code should be here...");
+    debug_with_guard(get_typename() + "::~allocator_sorted_list() : called");
+    release_trusted_memory();
 }
 
 allocator_sorted_list::allocator_sorted_list(
-    allocator_sorted_list &&other) noexcept
+    allocator_sorted_list &&other) noexcept:
+    _trusted_memory(other._trusted_memory)
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(allocator_sorted_list &&) noexcept", "your code should be here...");
+    other._trusted_memory = nullptr;
 }
 
 allocator_sorted_list &allocator_sorted_list::operator=(
     allocator_sorted_list &&other) noexcept
 {
-    throw not_implemented("allocator_sorted_list &allocator_sorted_list::operator=(allocator_sorted_list &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        if (_trusted_memory != nullptr)
+        {
+            release_trusted_memory();
+        }
+
+        _trusted_memory = other._trusted_memory;
+        other._trusted_memory = nullptr;
+    }
+
+    return *this;
 }
 
 allocator_sorted_list::allocator_sorted_list(
     size_t space_size,
     allocator *parent_allocator,
     logger *logger,
-    allocator_with_fit_mode::fit_mode allocate_fit_mode)
+    allocator_with_fit_mode::fit_mode allocate_fit_mode,
+    std::vector<size_t> const &front_cache_size_classes,
+    trusted_memory_backing const &backing,
+    allocator_growth_policy const &growth_policy)
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < block_meta_size())
+    {
+        throw std::logic_error("space size is too small to store even a single block");
+    }
+
+    std::vector<size_t> size_classes(front_cache_size_classes.size());
+    std::transform(front_cache_size_classes.begin(), front_cache_size_classes.end(), size_classes.begin(), round_up_to_max_alignment);
+    std::sort(size_classes.begin(), size_classes.end());
+    size_classes.erase(std::unique(size_classes.begin(), size_classes.end()), size_classes.end());
+    size_classes.erase(std::remove(size_classes.begin(), size_classes.end(), 0), size_classes.end());
+
+    size_t const trusted_memory_size = meta_size() + size_classes.size() * sizeof(front_cache_entry) + space_size;
+    _trusted_memory = backing.allocate(trusted_memory_size, parent_allocator);
+
+    auto *memory = reinterpret_cast<unsigned char *>(_trusted_memory);
+
+    *reinterpret_cast<class logger **>(memory) = logger;
+    memory += sizeof(class logger *);
+
+    *reinterpret_cast<allocator **>(memory) = parent_allocator;
+    memory += sizeof(allocator *);
+
+    *reinterpret_cast<size_t *>(memory) = space_size;
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<size_t *>(memory) = size_classes.size();
+    memory += sizeof(size_t);
+
+    *reinterpret_cast<trusted_memory_backing *>(memory) = backing;
+    memory += sizeof(trusted_memory_backing);
+
+    *reinterpret_cast<allocator_growth_policy *>(memory) = growth_policy;
+    memory += sizeof(allocator_growth_policy);
+
+    *reinterpret_cast<void **>(memory) = nullptr;
+    memory += sizeof(void *);
+
+    *reinterpret_cast<size_t *>(memory) = 1;
+    memory += sizeof(size_t);
+
+    obtain_statistics_counters().reset();
+    memory += sizeof(allocator_with_statistics::statistics_counters);
+
+    *reinterpret_cast<allocator_with_compaction::handles_table **>(memory) = nullptr;
+    memory += sizeof(allocator_with_compaction::handles_table *);
+
+    *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(memory) = allocate_fit_mode;
+
+    front_cache_entry *front_cache = obtain_front_cache();
+    for (size_t i = 0; i < size_classes.size(); ++i)
+    {
+        front_cache[i].block_size = size_classes[i];
+        front_cache[i].first_block = nullptr;
+    }
+
+    void *first_block = obtain_first_block();
+    obtain_block_size(first_block) = space_size - block_meta_size();
+    obtain_block_pointer(first_block) = nullptr;
+    obtain_first_free_block() = first_block;
+    poison_free_block(first_block);
+    obtain_statistics_counters().on_free_block_appeared(space_size);
+
+    debug_with_guard(get_typename() + "::allocator_sorted_list(size_t, allocator *, logger *, allocator_with_fit_mode::fit_mode, std::vector<size_t> const &, trusted_memory_backing const &, allocator_growth_policy const &) : "
+        + "allocator with " + std::to_string(space_size) + " bytes of space and "
+        + std::to_string(size_classes.size()) + " front cache size classes constructed");
 }
 
 [[nodiscard]] void *allocator_sorted_list::allocate(
     size_t value_size,
     size_t values_count)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_sorted_list::allocate(size_t, size_t)", "your code should be here...");
+    return allocate(value_size, values_count, alignof(std::max_align_t));
+}
+
+[[nodiscard]] void *allocator_sorted_list::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().allocate_latency);
+
+    if (!is_valid_alignment(alignment))
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : alignment " + std::to_string(alignment) + " is not a power of two");
+
+        throw std::logic_error("alignment must be a power of two");
+    }
+
+    if (values_count != 0 && value_size > (std::numeric_limits<block_size_t>::max() - alignment - alignof(std::max_align_t) - block_meta_size() - allocator_debug_mode::canary_size()) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    // block sizes stay multiples of the maximum alignment, so every block header and payload is aligned at least that much
+    block_size_t requested_size = round_up_to_max_alignment(value_size * values_count + allocator_debug_mode::canary_size());
+    front_cache_entry *cache_entry = alignment <= alignof(std::max_align_t)
+        ? find_front_cache_entry(requested_size)
+        : nullptr;
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+
+    if (cache_entry != nullptr && cache_entry->first_block != nullptr)
+    {
+        void *block = cache_entry->first_block;
+        cache_entry->first_block = obtain_block_pointer(block);
+        obtain_block_pointer(block) = _trusted_memory;
+        allocator_debug_mode::set_canary(obtain_next_block(block));
+
+        counters.on_free_block_disappeared(obtain_block_size(block) + block_meta_size());
+        ++counters.allocations_count;
+        counters.bytes_in_use += obtain_block_size(block) + block_meta_size();
+        refresh_largest_free_block_size();
+
+        return reinterpret_cast<unsigned char *>(block) + block_meta_size();
+    }
+
+    if (cache_entry != nullptr)
+    {
+        requested_size = cache_entry->block_size;
+    }
+
+    void *block = allocate_from_free_list(requested_size, alignment);
+
+    if (block == nullptr && obtain_front_cache_size() != 0)
+    {
+        debug_with_guard([&]()
+        {
+            return get_typename() + "::allocate(size_t, size_t, size_t) : free list exhausted, flushing front cache";
+        });
+
+        flush_front_cache();
+        block = allocate_from_free_list(requested_size, alignment);
+    }
+
+    if (block == nullptr && try_grow(alignment <= alignof(std::max_align_t)
+        ? requested_size
+        : requested_size + alignment + block_meta_size()))
+    {
+        block = allocate_from_free_list(requested_size, alignment);
+    }
+
+    refresh_largest_free_block_size();
+
+    if (block == nullptr)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t, size_t) : can't allocate "
+            + std::to_string(requested_size) + " bytes");
+
+        throw std::bad_alloc();
+    }
+
+    allocator_debug_mode::set_canary(obtain_next_block(block));
+    ++counters.allocations_count;
+    counters.bytes_in_use += obtain_block_size(block) + block_meta_size();
+
+    return reinterpret_cast<unsigned char *>(block) + block_meta_size();
 }
 
 void allocator_sorted_list::deallocate(
     void *at)
 {
-    throw not_implemented("void allocator_sorted_list::deallocate(void *)", "your code should be here...");
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    allocator_with_statistics::latency_recorder const recorder(obtain_statistics_counters(), obtain_statistics_counters().deallocate_latency);
+    auto *block = reinterpret_cast<unsigned char *>(at) - block_meta_size();
+
+    if (!is_owned_block_address(block) || obtain_block_pointer(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate block not owned by allocator");
+
+        throw std::logic_error("attempt to deallocate block not owned by allocator");
+    }
+
+    if (obtain_handles_table() != nullptr && obtain_handles_table()->contains(at))
+    {
+        error_with_guard(get_typename() + "::deallocate(void *) : attempt to deallocate relocatable block by pointer");
+
+        throw std::logic_error("relocatable block must be deallocated through its handle");
+    }
+
+    if (allocator_debug_mode::is_enabled())
+    {
+        verify_block_neighbourhood(block, "deallocate(void *)");
+    }
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    ++counters.deallocations_count;
+    counters.bytes_in_use -= obtain_block_size(block) + block_meta_size();
+
+    front_cache_entry *cache_entry = find_front_cache_entry(obtain_block_size(block));
+
+    if (cache_entry != nullptr && cache_entry->block_size == obtain_block_size(block))
+    {
+        obtain_block_pointer(block) = cache_entry->first_block;
+        cache_entry->first_block = block;
+        counters.on_free_block_appeared(obtain_block_size(block) + block_meta_size());
+        poison_free_block(block);
+
+        return;
+    }
+
+    try_release_segment(insert_to_free_list(block));
+    refresh_largest_free_block_size();
+}
+
+void allocator_sorted_list::allocate_batch(
+    size_t block_size,
+    size_t blocks_count,
+    void **blocks)
+{
+    if (block_size > std::numeric_limits<block_size_t>::max() - alignof(std::max_align_t) - block_meta_size() - allocator_debug_mode::canary_size())
+    {
+        error_with_guard(get_typename() + "::allocate_batch(size_t, size_t, void **) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_block_size = block_size;
+    block_size = round_up_to_max_alignment(block_size + allocator_debug_mode::canary_size());
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    front_cache_entry *cache_entry = find_front_cache_entry(block_size);
+    size_t allocated_count = 0;
+
+    if (cache_entry != nullptr)
+    {
+        block_size = cache_entry->block_size;
+
+        for (; allocated_count < blocks_count && cache_entry->first_block != nullptr; ++allocated_count)
+        {
+            void *block = cache_entry->first_block;
+            cache_entry->first_block = obtain_block_pointer(block);
+            obtain_block_pointer(block) = _trusted_memory;
+            allocator_debug_mode::set_canary(obtain_next_block(block));
+
+            counters.on_free_block_disappeared(block_size + block_meta_size());
+            ++counters.allocations_count;
+            counters.bytes_in_use += block_size + block_meta_size();
+
+            blocks[allocated_count] = reinterpret_cast<unsigned char *>(block) + block_meta_size();
+        }
+    }
+
+    block_size_t const stride = block_meta_size() + block_size;
+    void *previous_block = nullptr;
+    void *current_block = obtain_first_free_block();
+
+    while (current_block != nullptr && allocated_count < blocks_count)
+    {
+        block_size_t region_size = obtain_block_size(current_block) + block_meta_size();
+        void *next_free_block = obtain_block_pointer(current_block);
+
+        if (region_size < stride)
+        {
+            previous_block = current_block;
+            current_block = next_free_block;
+
+            continue;
+        }
+
+        counters.on_free_block_disappeared(region_size);
+
+        void *block = current_block;
+
+        while (allocated_count < blocks_count && region_size >= stride)
+        {
+            region_size -= stride;
+            obtain_block_size(block) = block_size;
+
+            if (region_size < block_meta_size())
+            {
+                obtain_block_size(block) += region_size;
+                region_size = 0;
+            }
+
+            obtain_block_pointer(block) = _trusted_memory;
+            allocator_debug_mode::set_canary(obtain_next_block(block));
+            ++counters.allocations_count;
+            counters.bytes_in_use += obtain_block_size(block) + block_meta_size();
+
+            blocks[allocated_count++] = reinterpret_cast<unsigned char *>(block) + block_meta_size();
+            block = obtain_next_block(block);
+        }
+
+        if (region_size != 0)
+        {
+            obtain_block_size(block) = region_size - block_meta_size();
+            obtain_block_pointer(block) = next_free_block;
+            counters.on_free_block_appeared(region_size);
+
+            next_free_block = block;
+        }
+
+        (previous_block == nullptr
+            ? obtain_first_free_block()
+            : obtain_block_pointer(previous_block)) = next_free_block;
+        current_block = next_free_block;
+    }
+
+    refresh_largest_free_block_size();
+
+    try
+    {
+        for (; allocated_count < blocks_count; ++allocated_count)
+        {
+            blocks[allocated_count] = allocate(requested_block_size, 1);
+        }
+    }
+    catch (...)
+    {
+        deallocate_batch(blocks, allocated_count);
+
+        throw;
+    }
+}
+
+void allocator_sorted_list::deallocate_batch(
+    void **blocks,
+    size_t blocks_count)
+{
+    std::vector<void *> sorted_blocks;
+    sorted_blocks.reserve(blocks_count);
+
+    for (size_t i = 0; i < blocks_count; ++i)
+    {
+        if (blocks[i] == nullptr)
+        {
+            continue;
+        }
+
+        auto *block = reinterpret_cast<unsigned char *>(blocks[i]) - block_meta_size();
+
+        if (!is_owned_block_address(block) || obtain_block_pointer(block) != _trusted_memory)
+        {
+            error_with_guard(get_typename() + "::deallocate_batch(void **, size_t) : attempt to deallocate block not owned by allocator");
+
+            throw std::logic_error("attempt to deallocate block not owned by allocator");
+        }
+
+        if (obtain_handles_table() != nullptr && obtain_handles_table()->contains(blocks[i]))
+        {
+            error_with_guard(get_typename() + "::deallocate_batch(void **, size_t) : attempt to deallocate relocatable block by pointer");
+
+            throw std::logic_error("relocatable block must be deallocated through its handle");
+        }
+
+        if (allocator_debug_mode::is_enabled())
+        {
+            verify_block_neighbourhood(block, "deallocate_batch(void **, size_t)");
+        }
+
+        sorted_blocks.push_back(block);
+    }
+
+    std::sort(sorted_blocks.begin(), sorted_blocks.end());
+
+    if (std::adjacent_find(sorted_blocks.begin(), sorted_blocks.end()) != sorted_blocks.end())
+    {
+        error_with_guard(get_typename() + "::deallocate_batch(void **, size_t) : attempt to deallocate block twice");
+
+        throw std::logic_error("attempt to deallocate block twice");
+    }
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    void *previous_free_block = nullptr;
+
+    for (void *block: sorted_blocks)
+    {
+        ++counters.deallocations_count;
+        counters.bytes_in_use -= obtain_block_size(block) + block_meta_size();
+
+        front_cache_entry *cache_entry = find_front_cache_entry(obtain_block_size(block));
+
+        if (cache_entry != nullptr && cache_entry->block_size == obtain_block_size(block))
+        {
+            obtain_block_pointer(block) = cache_entry->first_block;
+            cache_entry->first_block = block;
+            counters.on_free_block_appeared(obtain_block_size(block) + block_meta_size());
+            poison_free_block(block);
+
+            continue;
+        }
+
+        void *merged_block = insert_to_free_list(block, previous_free_block);
+        previous_free_block = try_release_segment(merged_block)
+            ? nullptr
+            : merged_block;
+    }
+
+    refresh_largest_free_block_size();
+}
+
+bool allocator_sorted_list::try_expand_in_place(
+    void *at,
+    size_t value_size,
+    size_t values_count)
+{
+    auto *block = reinterpret_cast<unsigned char *>(at) - block_meta_size();
+
+    if (!is_owned_block_address(block) || obtain_block_pointer(block) != _trusted_memory)
+    {
+        error_with_guard(get_typename() + "::try_expand_in_place(void *, size_t, size_t) : attempt to expand block not owned by allocator");
+
+        throw std::logic_error("attempt to expand block not owned by allocator");
+    }
+
+    if (values_count != 0 && value_size > (std::numeric_limits<block_size_t>::max() - alignof(std::max_align_t) - allocator_debug_mode::canary_size()) / values_count)
+    {
+        return false;
+    }
+
+    block_size_t const requested_size = round_up_to_max_alignment(value_size * values_count + allocator_debug_mode::canary_size());
+    block_size_t const block_size = obtain_block_size(block);
+
+    if (requested_size <= block_size)
+    {
+        return true;
+    }
+
+    void *next_block = obtain_next_block(block);
+    void *previous_free_block = nullptr;
+    void *free_block = obtain_first_free_block();
+
+    while (free_block != nullptr && free_block < next_block)
+    {
+        previous_free_block = free_block;
+        free_block = obtain_block_pointer(free_block);
+    }
+
+    if (free_block != next_block || block_size + block_meta_size() + obtain_block_size(next_block) < requested_size)
+    {
+        return false;
+    }
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    block_size_t const expanded_size = block_size + block_meta_size() + obtain_block_size(next_block);
+    void *next_free_block = obtain_block_pointer(next_block);
+    counters.on_free_block_disappeared(obtain_block_size(next_block) + block_meta_size());
+
+    if (expanded_size - requested_size >= block_meta_size())
+    {
+        void *rest_block = block + block_meta_size() + requested_size;
+        obtain_block_size(rest_block) = expanded_size - requested_size - block_meta_size();
+        obtain_block_pointer(rest_block) = next_free_block;
+        counters.on_free_block_appeared(obtain_block_size(rest_block) + block_meta_size());
+
+        obtain_block_size(block) = requested_size;
+        next_free_block = rest_block;
+    }
+    else
+    {
+        obtain_block_size(block) = expanded_size;
+    }
+
+    (previous_free_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_block_pointer(previous_free_block)) = next_free_block;
+    allocator_debug_mode::set_canary(obtain_next_block(block));
+    counters.bytes_in_use += obtain_block_size(block) - block_size;
+    refresh_largest_free_block_size();
+
+    return true;
+}
+
+allocator_with_compaction::handle_t allocator_sorted_list::allocate_relocatable(
+    size_t value_size,
+    size_t values_count)
+{
+    void *at = allocate(value_size, values_count);
+    allocator_with_compaction::handles_table *&table = obtain_handles_table();
+
+    try
+    {
+        if (table == nullptr)
+        {
+            table = new allocator_with_compaction::handles_table;
+        }
+
+        return table->insert(at);
+    }
+    catch (...)
+    {
+        deallocate(at);
+
+        throw;
+    }
+}
+
+void allocator_sorted_list::deallocate_relocatable(
+    allocator_with_compaction::handle_t handle)
+{
+    allocator_with_compaction::handles_table &table = obtain_valid_handles_table(handle, "deallocate_relocatable(allocator_with_compaction::handle_t)");
+
+    if (table.is_locked(handle))
+    {
+        error_with_guard(get_typename() + "::deallocate_relocatable(allocator_with_compaction::handle_t) : attempt to deallocate locked block");
+
+        throw std::logic_error("attempt to deallocate locked block");
+    }
+
+    deallocate(table.erase(handle));
+}
+
+void *allocator_sorted_list::lock(
+    allocator_with_compaction::handle_t handle)
+{
+    return obtain_valid_handles_table(handle, "lock(allocator_with_compaction::handle_t)").lock(handle);
+}
+
+void allocator_sorted_list::unlock(
+    allocator_with_compaction::handle_t handle)
+{
+    allocator_with_compaction::handles_table &table = obtain_valid_handles_table(handle, "unlock(allocator_with_compaction::handle_t)");
+
+    if (!table.is_locked(handle))
+    {
+        error_with_guard(get_typename() + "::unlock(allocator_with_compaction::handle_t) : attempt to unlock block which is not locked");
+
+        throw std::logic_error("attempt to unlock block which is not locked");
+    }
+
+    table.unlock(handle);
+}
+
+size_t allocator_sorted_list::compact(
+    size_t max_relocations_count)
+{
+    if (obtain_handles_table() == nullptr || obtain_handles_table()->size() == 0)
+    {
+        return 0;
+    }
+
+    flush_front_cache();
+
+    size_t relocations_count = 0;
+    void *previous_free_block = nullptr;
+    void *free_block = obtain_first_free_block();
+
+    while (free_block != nullptr && relocations_count < max_relocations_count)
+    {
+        void *relocated_free_block = relocate_next_block(free_block, previous_free_block);
+
+        if (relocated_free_block == nullptr)
+        {
+            previous_free_block = free_block;
+            free_block = obtain_block_pointer(free_block);
+
+            continue;
+        }
+
+        ++relocations_count;
+
+        free_block = try_release_segment(relocated_free_block)
+            ? (previous_free_block == nullptr
+                ? obtain_first_free_block()
+                : obtain_block_pointer(previous_free_block))
+            : relocated_free_block;
+    }
+
+    refresh_largest_free_block_size();
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::compact(size_t) : " + std::to_string(relocations_count) + " blocks relocated";
+    });
+
+    return relocations_count;
 }
 
 inline void allocator_sorted_list::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_sorted_list::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    obtain_fit_mode() = mode;
 }
 
 inline allocator *allocator_sorted_list::get_allocator() const
 {
-    throw not_implemented("inline allocator *allocator_sorted_list::get_allocator() const", "your code should be here...");
+    return *reinterpret_cast<allocator **>(reinterpret_cast<unsigned char *>(_trusted_memory) + sizeof(logger *));
+}
+
+allocator_with_statistics::statistics allocator_sorted_list::get_statistics() const noexcept
+{
+    allocator_with_statistics::statistics_counters const &counters = obtain_statistics_counters();
+
+    size_t space_size = obtain_space_size();
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        space_size += obtain_segment_space_size(segment);
+    }
+
+    return collect_statistics(counters, space_size, counters.largest_free_block_size);
+}
+
+void allocator_sorted_list::set_latency_sampling_period(
+    size_t period) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.latency_sampling_period = period;
+    counters.operations_since_latency_sample = 0;
 }
 
 std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const noexcept
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const noexcept", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> blocks_info;
+
+    for (auto const &segment_blocks_info: get_segments_blocks_info())
+    {
+        blocks_info.insert(blocks_info.end(), segment_blocks_info.begin(), segment_blocks_info.end());
+    }
+
+    return blocks_info;
+}
+
+std::vector<std::vector<allocator_test_utils::block_info>> allocator_sorted_list::get_segments_blocks_info() const noexcept
+{
+    std::unordered_set<void *> free_blocks;
+    for (void *block = obtain_first_free_block(); block != nullptr; block = obtain_block_pointer(block))
+    {
+        free_blocks.insert(block);
+    }
+
+    front_cache_entry *front_cache = obtain_front_cache();
+    for (size_t i = 0; i < obtain_front_cache_size(); ++i)
+    {
+        for (void *block = front_cache[i].first_block; block != nullptr; block = obtain_block_pointer(block))
+        {
+            free_blocks.insert(block);
+        }
+    }
+
+    std::vector<std::pair<void *, void *>> segments_bounds { { obtain_first_block(), obtain_space_end() } };
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        segments_bounds.emplace(segments_bounds.begin() + 1, obtain_segment_first_block(segment), obtain_segment_space_end(segment));
+    }
+
+    std::vector<std::vector<allocator_test_utils::block_info>> segments_blocks_info;
+
+    for (auto const &segment_bounds: segments_bounds)
+    {
+        segments_blocks_info.emplace_back();
+
+        for (void *block = segment_bounds.first; block < segment_bounds.second; block = obtain_next_block(block))
+        {
+            segments_blocks_info.back().push_back(
+                {
+                    obtain_block_size(block) + block_meta_size(),
+                    free_blocks.find(block) == free_blocks.end()
+                });
+        }
+    }
+
+    return segments_blocks_info;
 }
 
 inline logger *allocator_sorted_list::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_sorted_list::get_logger() const", "your code should be here...");
+    return *reinterpret_cast<logger **>(_trusted_memory);
 }
 
 inline std::string allocator_sorted_list::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_sorted_list::get_typename() const noexcept", "your code should be here...");
-}
\ No newline at end of file
+    return "allocator_sorted_list";
+}
+
+// region trusted memory layout
+
+constexpr size_t allocator_sorted_list::meta_size() noexcept
+{
+    return (sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t)
+        + sizeof(trusted_memory_backing) + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t)
+        + sizeof(allocator_with_statistics::statistics_counters) + sizeof(allocator_with_compaction::handles_table *)
+        + sizeof(allocator_with_fit_mode::fit_mode) + alignof(std::max_align_t) - 1)
+        / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+constexpr size_t allocator_sorted_list::block_meta_size() noexcept
+{
+    return sizeof(block_size_t) + sizeof(block_pointer_t);
+}
+
+constexpr size_t allocator_sorted_list::segment_meta_size() noexcept
+{
+    return (sizeof(void *) + sizeof(size_t) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+inline allocator_with_fit_mode::fit_mode &allocator_sorted_list::obtain_fit_mode() const noexcept
+{
+    return *reinterpret_cast<allocator_with_fit_mode::fit_mode *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters)
+        + sizeof(allocator_with_compaction::handles_table *));
+}
+
+inline size_t allocator_sorted_list::obtain_space_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *));
+}
+
+inline void *&allocator_sorted_list::obtain_first_free_block() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t));
+}
+
+inline size_t allocator_sorted_list::obtain_front_cache_size() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *));
+}
+
+inline allocator_sorted_list::front_cache_entry *allocator_sorted_list::obtain_front_cache() const noexcept
+{
+    return reinterpret_cast<front_cache_entry *>(reinterpret_cast<unsigned char *>(_trusted_memory) + meta_size());
+}
+
+inline void *allocator_sorted_list::obtain_first_block() const noexcept
+{
+    return obtain_front_cache() + obtain_front_cache_size();
+}
+
+inline void *allocator_sorted_list::obtain_space_end() const noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_first_block()) + obtain_space_size();
+}
+
+inline trusted_memory_backing &allocator_sorted_list::obtain_trusted_memory_backing() const noexcept
+{
+    return *reinterpret_cast<trusted_memory_backing *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t));
+}
+
+inline allocator_growth_policy &allocator_sorted_list::obtain_growth_policy() const noexcept
+{
+    return *reinterpret_cast<allocator_growth_policy *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) + sizeof(trusted_memory_backing));
+}
+
+inline void *&allocator_sorted_list::obtain_last_segment() const noexcept
+{
+    return *reinterpret_cast<void **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy));
+}
+
+inline size_t &allocator_sorted_list::obtain_segments_count() const noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *));
+}
+
+inline allocator_with_statistics::statistics_counters &allocator_sorted_list::obtain_statistics_counters() const noexcept
+{
+    return *reinterpret_cast<allocator_with_statistics::statistics_counters *>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t));
+}
+
+inline allocator_with_compaction::handles_table *&allocator_sorted_list::obtain_handles_table() const noexcept
+{
+    return *reinterpret_cast<allocator_with_compaction::handles_table **>(reinterpret_cast<unsigned char *>(_trusted_memory)
+        + sizeof(logger *) + sizeof(allocator *) + sizeof(size_t) + sizeof(void *) + sizeof(size_t) + sizeof(trusted_memory_backing)
+        + sizeof(allocator_growth_policy) + sizeof(void *) + sizeof(size_t) + sizeof(allocator_with_statistics::statistics_counters));
+}
+
+void allocator_sorted_list::release_trusted_memory()
+{
+    delete obtain_handles_table();
+
+    trusted_memory_backing const backing = obtain_trusted_memory_backing();
+
+    for (void *segment = obtain_last_segment(); segment != nullptr;)
+    {
+        void *previous_segment = obtain_previous_segment(segment);
+        backing.deallocate(segment, segment_meta_size() + obtain_segment_space_size(segment), get_allocator());
+        segment = previous_segment;
+    }
+
+    backing.deallocate(_trusted_memory, reinterpret_cast<unsigned char *>(obtain_space_end()) - reinterpret_cast<unsigned char *>(_trusted_memory), get_allocator());
+}
+
+inline allocator::block_size_t &allocator_sorted_list::obtain_block_size(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_size_t *>(block);
+}
+
+inline allocator::block_pointer_t &allocator_sorted_list::obtain_block_pointer(
+    void *block) noexcept
+{
+    return *reinterpret_cast<block_pointer_t *>(reinterpret_cast<unsigned char *>(block) + sizeof(block_size_t));
+}
+
+inline void *allocator_sorted_list::obtain_next_block(
+    void *block) noexcept
+{
+    return reinterpret_cast<unsigned char *>(block) + block_meta_size() + obtain_block_size(block);
+}
+
+inline void *&allocator_sorted_list::obtain_previous_segment(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<void **>(segment);
+}
+
+inline size_t &allocator_sorted_list::obtain_segment_space_size(
+    void *segment) noexcept
+{
+    return *reinterpret_cast<size_t *>(reinterpret_cast<unsigned char *>(segment) + sizeof(void *));
+}
+
+inline void *allocator_sorted_list::obtain_segment_first_block(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(segment) + segment_meta_size();
+}
+
+inline void *allocator_sorted_list::obtain_segment_space_end(
+    void *segment) noexcept
+{
+    return reinterpret_cast<unsigned char *>(obtain_segment_first_block(segment)) + obtain_segment_space_size(segment);
+}
+
+// endregion trusted memory layout
+
+// region segments manipulation
+
+bool allocator_sorted_list::is_owned_block_address(
+    void *block) const noexcept
+{
+    if (block >= obtain_first_block() && block < obtain_space_end())
+    {
+        return true;
+    }
+
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        if (block >= obtain_segment_first_block(segment) && block < obtain_segment_space_end(segment))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void *allocator_sorted_list::obtain_owning_space_end(
+    void *block) const noexcept
+{
+    if (block >= obtain_first_block() && block < obtain_space_end())
+    {
+        return obtain_space_end();
+    }
+
+    for (void *segment = obtain_last_segment(); segment != nullptr; segment = obtain_previous_segment(segment))
+    {
+        if (block >= obtain_segment_first_block(segment) && block < obtain_segment_space_end(segment))
+        {
+            return obtain_segment_space_end(segment);
+        }
+    }
+
+    return nullptr;
+}
+
+bool allocator_sorted_list::try_grow(
+    block_size_t requested_size)
+{
+    allocator_growth_policy const &growth_policy = obtain_growth_policy();
+
+    if (!growth_policy.can_grow(obtain_segments_count()) || requested_size > std::numeric_limits<size_t>::max() - block_meta_size() - segment_meta_size())
+    {
+        return false;
+    }
+
+    size_t const segment_space_size = growth_policy.obtain_segment_size(obtain_space_size(), requested_size + block_meta_size());
+    void *segment = obtain_trusted_memory_backing().allocate(segment_meta_size() + segment_space_size, get_allocator());
+
+    obtain_previous_segment(segment) = obtain_last_segment();
+    obtain_segment_space_size(segment) = segment_space_size;
+    obtain_last_segment() = segment;
+    ++obtain_segments_count();
+
+    void *block = obtain_segment_first_block(segment);
+    obtain_block_size(block) = segment_space_size - block_meta_size();
+    insert_to_free_list(block);
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::allocate(size_t, size_t) : segment of "
+            + std::to_string(segment_space_size) + " bytes allocated";
+    });
+
+    return true;
+}
+
+bool allocator_sorted_list::try_release_segment(
+    void *block) noexcept
+{
+    if (!obtain_growth_policy().is_releasing_empty_segments())
+    {
+        return false;
+    }
+
+    void *segment = reinterpret_cast<unsigned char *>(block) - segment_meta_size();
+    void *next_segment = nullptr;
+
+    for (void *current_segment = obtain_last_segment(); current_segment != segment; current_segment = obtain_previous_segment(current_segment))
+    {
+        if (current_segment == nullptr)
+        {
+            return false;
+        }
+
+        next_segment = current_segment;
+    }
+
+    if (obtain_block_size(block) + block_meta_size() != obtain_segment_space_size(segment))
+    {
+        return false;
+    }
+
+    remove_from_free_list(block);
+    obtain_statistics_counters().on_free_block_disappeared(obtain_segment_space_size(segment));
+
+    (next_segment == nullptr
+        ? obtain_last_segment()
+        : obtain_previous_segment(next_segment)) = obtain_previous_segment(segment);
+    --obtain_segments_count();
+
+    size_t const segment_space_size = obtain_segment_space_size(segment);
+    obtain_trusted_memory_backing().deallocate(segment, segment_meta_size() + segment_space_size, get_allocator());
+
+    debug_with_guard([&]()
+    {
+        return get_typename() + "::deallocate(void *) : empty segment of "
+            + std::to_string(segment_space_size) + " bytes released";
+    });
+
+    return true;
+}
+
+// endregion segments manipulation
+
+// region free list manipulation
+
+void *allocator_sorted_list::allocate_from_free_list(
+    block_size_t requested_size,
+    size_t alignment)
+{
+    allocator_with_fit_mode::fit_mode const fit_mode = obtain_fit_mode();
+
+    void *target_previous_block = nullptr;
+    void *target_block = nullptr;
+
+    for (void *previous_block = nullptr, *current_block = obtain_first_free_block();
+         current_block != nullptr;
+         previous_block = current_block, current_block = obtain_block_pointer(current_block))
+    {
+        block_size_t const current_block_size = obtain_block_size(current_block);
+
+        if (current_block_size < requested_size + obtain_leading_fragment_size(current_block, alignment))
+        {
+            continue;
+        }
+
+        if (target_block == nullptr
+            || (fit_mode == allocator_with_fit_mode::fit_mode::the_best_fit && current_block_size < obtain_block_size(target_block))
+            || (fit_mode == allocator_with_fit_mode::fit_mode::the_worst_fit && current_block_size > obtain_block_size(target_block)))
+        {
+            target_previous_block = previous_block;
+            target_block = current_block;
+
+            if (fit_mode == allocator_with_fit_mode::fit_mode::first_fit)
+            {
+                break;
+            }
+        }
+    }
+
+    if (target_block == nullptr)
+    {
+        return nullptr;
+    }
+
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    counters.on_free_block_disappeared(obtain_block_size(target_block) + block_meta_size());
+
+    block_size_t const leading_fragment_size = obtain_leading_fragment_size(target_block, alignment);
+
+    if (leading_fragment_size != 0)
+    {
+        void *leading_fragment = target_block;
+        target_block = reinterpret_cast<unsigned char *>(leading_fragment) + leading_fragment_size;
+        obtain_block_size(target_block) = obtain_block_size(leading_fragment) - leading_fragment_size;
+        obtain_block_pointer(target_block) = obtain_block_pointer(leading_fragment);
+        obtain_block_size(leading_fragment) = leading_fragment_size - block_meta_size();
+        counters.on_free_block_appeared(leading_fragment_size);
+
+        target_previous_block = leading_fragment;
+    }
+
+    block_size_t const target_block_size = obtain_block_size(target_block);
+    void *next_free_block = obtain_block_pointer(target_block);
+
+    if (target_block_size - requested_size >= block_meta_size())
+    {
+        void *rest_block = reinterpret_cast<unsigned char *>(target_block) + block_meta_size() + requested_size;
+        obtain_block_size(rest_block) = target_block_size - requested_size - block_meta_size();
+        obtain_block_pointer(rest_block) = next_free_block;
+
+        obtain_block_size(target_block) = requested_size;
+        next_free_block = rest_block;
+        counters.on_free_block_appeared(obtain_block_size(rest_block) + block_meta_size());
+    }
+    else if (target_block_size != requested_size)
+    {
+        warning_with_guard([&]()
+        {
+            return get_typename() + "::allocate(size_t, size_t, size_t) : requested size "
+                + std::to_string(requested_size) + " was enlarged to " + std::to_string(target_block_size);
+        });
+    }
+
+    (target_previous_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_block_pointer(target_previous_block)) = next_free_block;
+    obtain_block_pointer(target_block) = _trusted_memory;
+
+    return target_block;
+}
+
+allocator::block_size_t allocator_sorted_list::obtain_leading_fragment_size(
+    void *block,
+    size_t alignment) noexcept
+{
+    auto const payload_address = reinterpret_cast<uintptr_t>(block) + block_meta_size();
+    block_size_t leading_fragment_size = (alignment - payload_address % alignment) % alignment;
+
+    while (leading_fragment_size != 0 && leading_fragment_size < block_meta_size())
+    {
+        leading_fragment_size += alignment;
+    }
+
+    return leading_fragment_size;
+}
+
+void *allocator_sorted_list::insert_to_free_list(
+    void *block,
+    void *previous_free_block_hint) noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+    void *freed_block = block;
+    size_t const freed_size = block_meta_size() + obtain_block_size(block);
+    void *previous_block = previous_free_block_hint;
+    void *next_block = previous_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_block_pointer(previous_block);
+
+    while (next_block != nullptr && next_block < block)
+    {
+        previous_block = next_block;
+        next_block = obtain_block_pointer(next_block);
+    }
+
+    obtain_block_pointer(block) = next_block;
+    (previous_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_block_pointer(previous_block)) = block;
+
+    if (next_block != nullptr && obtain_next_block(block) == next_block)
+    {
+        counters.on_free_block_disappeared(obtain_block_size(next_block) + block_meta_size());
+        obtain_block_size(block) += block_meta_size() + obtain_block_size(next_block);
+        obtain_block_pointer(block) = obtain_block_pointer(next_block);
+    }
+
+    if (previous_block != nullptr && obtain_next_block(previous_block) == block)
+    {
+        counters.on_free_block_disappeared(obtain_block_size(previous_block) + block_meta_size());
+        obtain_block_size(previous_block) += block_meta_size() + obtain_block_size(block);
+        obtain_block_pointer(previous_block) = obtain_block_pointer(block);
+        block = previous_block;
+    }
+
+    counters.on_free_block_appeared(obtain_block_size(block) + block_meta_size());
+    poison_free_block(block, freed_block, freed_size);
+    obtain_trusted_memory_backing().release_free_pages(reinterpret_cast<unsigned char *>(block) + block_meta_size(), obtain_block_size(block),
+        freed_block, freed_size);
+
+    return block;
+}
+
+void allocator_sorted_list::remove_from_free_list(
+    void *block) noexcept
+{
+    void *previous_block = nullptr;
+
+    for (void *current_block = obtain_first_free_block(); current_block != block; current_block = obtain_block_pointer(current_block))
+    {
+        previous_block = current_block;
+    }
+
+    (previous_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_block_pointer(previous_block)) = obtain_block_pointer(block);
+}
+
+void allocator_sorted_list::refresh_largest_free_block_size() noexcept
+{
+    allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+
+    if (counters.is_largest_free_block_size_actual)
+    {
+        return;
+    }
+
+    block_size_t largest_free_block_size = 0;
+    size_t largest_free_blocks_count = 0;
+
+    auto const account = [&](block_size_t free_block_size)
+    {
+        if (free_block_size > largest_free_block_size)
+        {
+            largest_free_block_size = free_block_size;
+            largest_free_blocks_count = 0;
+        }
+
+        if (free_block_size == largest_free_block_size)
+        {
+            ++largest_free_blocks_count;
+        }
+    };
+
+    for (void *block = obtain_first_free_block(); block != nullptr; block = obtain_block_pointer(block))
+    {
+        account(obtain_block_size(block) + block_meta_size());
+    }
+
+    front_cache_entry *front_cache = obtain_front_cache();
+    for (size_t i = 0; i < obtain_front_cache_size(); ++i)
+    {
+        for (void *block = front_cache[i].first_block; block != nullptr; block = obtain_block_pointer(block))
+        {
+            account(front_cache[i].block_size + block_meta_size());
+        }
+    }
+
+    counters.largest_free_block_size = largest_free_block_size;
+    counters.largest_free_blocks_count = largest_free_blocks_count;
+    counters.is_largest_free_block_size_actual = true;
+}
+
+// endregion free list manipulation
+
+// region front cache manipulation
+
+allocator_sorted_list::front_cache_entry *allocator_sorted_list::find_front_cache_entry(
+    block_size_t requested_size) const noexcept
+{
+    front_cache_entry *front_cache_begin = obtain_front_cache();
+    front_cache_entry *front_cache_end = front_cache_begin + obtain_front_cache_size();
+
+    front_cache_entry *entry = std::lower_bound(front_cache_begin, front_cache_end, requested_size,
+        [](front_cache_entry const &entry, block_size_t size) { return entry.block_size < size; });
+
+    return entry == front_cache_end
+        ? nullptr
+        : entry;
+}
+
+void allocator_sorted_list::flush_front_cache() noexcept
+{
+    front_cache_entry *front_cache = obtain_front_cache();
+
+    for (size_t i = 0; i < obtain_front_cache_size(); ++i)
+    {
+        while (front_cache[i].first_block != nullptr)
+        {
+            void *block = front_cache[i].first_block;
+            front_cache[i].first_block = obtain_block_pointer(block);
+            obtain_statistics_counters().on_free_block_disappeared(obtain_block_size(block) + block_meta_size());
+            try_release_segment(insert_to_free_list(block));
+        }
+    }
+}
+
+// endregion front cache manipulation
+
+// region debug checks
+
+void allocator_sorted_list::verify_block_neighbourhood(
+    void *block,
+    char const *method_signature) const
+{
+    void *corrupted_block = nullptr;
+
+    if (!is_block_intact(block))
+    {
+        corrupted_block = block;
+    }
+    else if (obtain_next_block(block) < obtain_owning_space_end(block) && !is_block_intact(obtain_next_block(block)))
+    {
+        corrupted_block = obtain_next_block(block);
+    }
+
+    if (corrupted_block == nullptr)
+    {
+        return;
+    }
+
+    critical_with_guard(get_typename() + "::" + method_signature + " : memory corruption detected in block at "
+        + std::to_string(reinterpret_cast<uintptr_t>(corrupted_block)));
+
+    throw std::logic_error("memory corruption detected");
+}
+
+bool allocator_sorted_list::is_block_intact(
+    void *block) const noexcept
+{
+    if (obtain_next_block(block) > obtain_owning_space_end(block))
+    {
+        return false;
+    }
+
+    if (obtain_block_pointer(block) == _trusted_memory)
+    {
+        return allocator_debug_mode::is_canary_intact(obtain_next_block(block));
+    }
+
+    return obtain_trusted_memory_backing().is_mapped()
+        || allocator_debug_mode::is_poisoned(reinterpret_cast<unsigned char *>(block) + block_meta_size(),
+            std::min<size_t>(obtain_block_size(block), allocator_debug_mode::poison_check_size()));
+}
+
+void allocator_sorted_list::poison_free_block(
+    void *block) noexcept
+{
+    allocator_debug_mode::poison(reinterpret_cast<unsigned char *>(block) + block_meta_size(), obtain_block_size(block));
+}
+
+void allocator_sorted_list::poison_free_block(
+    void *block,
+    void *freed_block,
+    size_t freed_size) noexcept
+{
+    // the rest of a coalesced block is poisoned already, except for the absorbed neighbour meta next to the freed bytes
+    auto const payload_begin = reinterpret_cast<uintptr_t>(block) + block_meta_size();
+    auto const payload_end = payload_begin + obtain_block_size(block);
+    auto const freed_begin = reinterpret_cast<uintptr_t>(freed_block);
+    auto const poisoned_begin = std::max(payload_begin, freed_begin);
+    auto const poisoned_end = std::min(payload_end, freed_begin + freed_size + block_meta_size());
+
+    if (poisoned_begin < poisoned_end)
+    {
+        allocator_debug_mode::poison(reinterpret_cast<void *>(poisoned_begin), poisoned_end - poisoned_begin);
+    }
+}
+
+// endregion debug checks
+
+// region compaction
+
+allocator_with_compaction::handles_table &allocator_sorted_list::obtain_valid_handles_table(
+    allocator_with_compaction::handle_t handle,
+    char const *method_signature) const
+{
+    allocator_with_compaction::handles_table *table = obtain_handles_table();
+
+    if (table == nullptr || !table->is_valid(handle))
+    {
+        error_with_guard(get_typename() + "::" + method_signature + " : invalid relocatable block handle " + std::to_string(handle));
+
+        throw std::logic_error("invalid relocatable block handle");
+    }
+
+    return *table;
+}
+
+void *allocator_sorted_list::relocate_next_block(
+    void *free_block,
+    void *previous_free_block)
+{
+    void *next_block = obtain_next_block(free_block);
+
+    if (next_block == obtain_owning_space_end(free_block)
+        || !obtain_handles_table()->is_movable(reinterpret_cast<unsigned char *>(next_block) + block_meta_size()))
+    {
+        return nullptr;
+    }
+
+    block_size_t const free_block_size = obtain_block_size(free_block);
+    void *next_free_block = obtain_block_pointer(free_block);
+    size_t const relocated_size = block_meta_size() + obtain_block_size(next_block);
+
+    obtain_handles_table()->relocate(
+        reinterpret_cast<unsigned char *>(next_block) + block_meta_size(),
+        reinterpret_cast<unsigned char *>(free_block) + block_meta_size());
+    std::memmove(free_block, next_block, relocated_size);
+
+    void *relocated_free_block = reinterpret_cast<unsigned char *>(free_block) + relocated_size;
+    obtain_block_size(relocated_free_block) = free_block_size;
+    obtain_block_pointer(relocated_free_block) = next_free_block;
+    (previous_free_block == nullptr
+        ? obtain_first_free_block()
+        : obtain_block_pointer(previous_free_block)) = relocated_free_block;
+
+    if (next_free_block != nullptr && obtain_next_block(relocated_free_block) == next_free_block)
+    {
+        allocator_with_statistics::statistics_counters &counters = obtain_statistics_counters();
+        counters.on_free_block_disappeared(free_block_size + block_meta_size());
+        counters.on_free_block_disappeared(obtain_block_size(next_free_block) + block_meta_size());
+
+        obtain_block_size(relocated_free_block) += block_meta_size() + obtain_block_size(next_free_block);
+        obtain_block_pointer(relocated_free_block) = obtain_block_pointer(next_free_block);
+
+        counters.on_free_block_appeared(obtain_block_size(relocated_free_block) + block_meta_size());
+        poison_free_block(relocated_free_block, next_block, relocated_size);
+        obtain_trusted_memory_backing().release_free_pages(reinterpret_cast<unsigned char *>(relocated_free_block) + block_meta_size(), obtain_block_size(relocated_free_block),
+            next_block, relocated_size);
+    }
+    else
+    {
+        poison_free_block(relocated_free_block, next_block, relocated_size);
+    }
+
+    return relocated_free_block;
+}
+
+// endregion compaction
\ No newline at end of file
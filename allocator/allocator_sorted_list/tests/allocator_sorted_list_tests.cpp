@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <logger.h>
 #include <logger_builder.h>
@@ -30,6 +31,12 @@ logger *create_logger(
     return built_logger;
 }
 
+size_t round_up_to_max_alignment(
+    size_t size)
+{
+    return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
 TEST(allocatorSortedListPositiveTests, test1)
 {
     //TODO: logger
@@ -243,8 +250,376 @@ TEST(allocatorSortedListPositiveTests, test5)
 }
 
 
+TEST(allocatorSortedListPositiveTests, test6)
+{
+    size_t const canary_size = allocator_debug_mode::canary_size();
+    allocator *alloc = new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit,
+        std::vector<size_t> { 16, 32 });
+    
+    auto first_block = alloc->allocate(sizeof(char), 20);
+    auto second_block = alloc->allocate(sizeof(char), 100);
+    
+    alloc->deallocate(first_block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(alloc)->get_blocks_info();
+    std::vector<allocator_test_utils::block_info> expected_blocks_state
+        {
+            { .block_size = 32 + sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t), .is_block_occupied = false },
+            { .block_size = round_up_to_max_alignment(100 + canary_size) + sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t), .is_block_occupied = true },
+            { .block_size = 1000 - 32 - round_up_to_max_alignment(100 + canary_size) - (sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t)) * 2, .is_block_occupied = false }
+        };
+    
+    ASSERT_EQ(actual_blocks_state.size(), expected_blocks_state.size());
+    for (size_t i = 0; i < actual_blocks_state.size(); i++)
+    {
+        ASSERT_EQ(actual_blocks_state[i], expected_blocks_state[i]);
+    }
+    
+    auto third_block = alloc->allocate(sizeof(char), 17);
+    
+    ASSERT_EQ(first_block, third_block);
+    
+    alloc->deallocate(second_block);
+    alloc->deallocate(third_block);
+    
+    delete alloc;
+}
+
+TEST(allocatorSortedListPositiveTests, test7)
+{
+    size_t const block_meta_size = sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t);
+    size_t const canary_size = allocator_debug_mode::canary_size();
+    size_t const small_block_size = round_up_to_max_alignment(16 + canary_size);
+    allocator *alloc = new allocator_sorted_list((small_block_size + block_meta_size) * 4, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit,
+        std::vector<size_t> { small_block_size });
+    
+    std::vector<void *> small_blocks;
+    for (int i = 0; i < 4; i++)
+    {
+        small_blocks.push_back(alloc->allocate(sizeof(char), 16));
+    }
+    
+    for (auto block: small_blocks)
+    {
+        alloc->deallocate(block);
+    }
+    
+    auto large_block = alloc->allocate(sizeof(char), small_block_size * 4 + block_meta_size * 3 - canary_size);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(alloc)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, true);
+    
+    alloc->deallocate(large_block);
+    
+    delete alloc;
+}
+
+
 //TODO: Тесты на особенность аллокатора?
 
+TEST(allocatorSortedListPositiveTests, test8)
+{
+    allocator *allocator_instance = new allocator_sorted_list(1 << 24, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, std::vector<size_t>(),
+        trusted_memory_backing(trusted_memory_backing::kind::transparent_huge_pages, 1 << 16));
+    
+    auto *block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    std::fill(block, block + (1 << 23), 0xAB);
+    allocator_instance->deallocate(block);
+    
+    block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 1 << 23));
+    
+    ASSERT_EQ(block[1 << 22], 0);
+    
+    allocator_instance->deallocate(block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test9)
+{
+    size_t const canary_size = allocator_debug_mode::canary_size();
+    allocator *allocator_instance = new allocator_sorted_list(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, std::vector<size_t> { 64 + canary_size });
+    auto *allocator_with_statistics_instance = dynamic_cast<allocator_with_statistics *>(allocator_instance);
+    allocator_with_statistics_instance->set_latency_sampling_period(1);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 64);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 200);
+    
+    allocator_instance->deallocate(first_block);
+    allocator_instance->deallocate(second_block);
+    
+    auto statistics = allocator_with_statistics_instance->get_statistics();
+    
+    ASSERT_EQ(statistics.allocations_count, 3);
+    ASSERT_EQ(statistics.deallocations_count, 2);
+    ASSERT_EQ(statistics.allocate_latency.total_count(), 3);
+    ASSERT_EQ(statistics.deallocate_latency.total_count(), 2);
+    ASSERT_EQ(statistics.bytes_in_use, round_up_to_max_alignment(200 + canary_size) + sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t));
+    ASSERT_EQ(statistics.bytes_in_use + statistics.bytes_free, 4096);
+    ASSERT_EQ(statistics.free_blocks_count, 3);
+    ASSERT_EQ(statistics.largest_free_block_size, 4096 - round_up_to_max_alignment(100 + canary_size) - round_up_to_max_alignment(64 + canary_size)
+        - round_up_to_max_alignment(200 + canary_size) - 3 * (sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t)));
+    ASSERT_GT(statistics.external_fragmentation, 0.0);
+    
+    allocator_instance->deallocate(third_block);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test10)
+{
+    allocator *allocator_instance = new allocator_sorted_list(1024, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, std::vector<size_t>(),
+        trusted_memory_backing(), allocator_growth_policy(4096, 3));
+    auto *allocator_test_utils_instance = dynamic_cast<allocator_test_utils *>(allocator_instance);
+    
+    void *first_block = allocator_instance->allocate(sizeof(unsigned char), 1000);
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 2000);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 1000);
+    void *fourth_block = allocator_instance->allocate(sizeof(unsigned char), 8000);
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 8000)), std::bad_alloc);
+    
+    auto segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 3);
+    ASSERT_EQ(segments_blocks_info[0].size(), 1);
+    ASSERT_EQ(segments_blocks_info[1].size(), 3);
+    ASSERT_EQ(segments_blocks_info[2].size(), 1);
+    ASSERT_EQ(segments_blocks_info[2][0].block_size, round_up_to_max_alignment(8000 + allocator_debug_mode::canary_size()) + sizeof(allocator::block_size_t) + sizeof(allocator::block_pointer_t));
+    
+    allocator_instance->deallocate(fourth_block);
+    allocator_instance->deallocate(second_block);
+    
+    ASSERT_EQ(allocator_test_utils_instance->get_segments_blocks_info().size(), 2);
+    
+    allocator_instance->deallocate(third_block);
+    
+    segments_blocks_info = allocator_test_utils_instance->get_segments_blocks_info();
+    
+    ASSERT_EQ(segments_blocks_info.size(), 1);
+    ASSERT_EQ(allocator_test_utils_instance->get_blocks_info(), segments_blocks_info[0]);
+    
+    allocator_instance->deallocate(first_block);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test11)
+{
+    allocator *allocator_instance = new allocator_sorted_list(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    void *second_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    void *third_block = allocator_instance->allocate(sizeof(unsigned char), 100);
+    
+    std::fill(first_block, first_block + 100, 0x5A);
+    allocator_instance->deallocate(second_block);
+    
+    ASSERT_TRUE(allocator_instance->try_expand_in_place(first_block, sizeof(unsigned char), 150));
+    ASSERT_FALSE(allocator_instance->try_expand_in_place(first_block, sizeof(unsigned char), 300));
+    ASSERT_EQ(allocator_instance->reallocate(first_block, sizeof(unsigned char), 150, 200), first_block);
+    
+    auto *relocated_block = reinterpret_cast<unsigned char *>(allocator_instance->reallocate(first_block, sizeof(unsigned char), 200, 1000));
+    
+    ASSERT_NE(relocated_block, first_block);
+    ASSERT_EQ(relocated_block[99], 0x5A);
+    
+    allocator_instance->deallocate(relocated_block);
+    allocator_instance->deallocate(third_block);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test12)
+{
+    allocator *allocator_instance = new allocator_sorted_list(1 << 16, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), 100, alignment);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignment, 0);
+        
+        std::fill(reinterpret_cast<unsigned char *>(block), reinterpret_cast<unsigned char *>(block) + 100, 0xCD);
+        blocks.push_back(block);
+    }
+    
+    ASSERT_THROW(static_cast<void>(allocator_instance->allocate(sizeof(unsigned char), 100, 48)), std::logic_error);
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test13)
+{
+    allocator *allocator_instance = new allocator_sorted_list(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *blocks[20];
+    allocator_instance->allocate_batch(sizeof(unsigned char) * 64, 20, blocks);
+    
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::fill(reinterpret_cast<unsigned char *>(blocks[i]), reinterpret_cast<unsigned char *>(blocks[i]) + 64, 0xAB);
+        
+        if (i != 0)
+        {
+            ASSERT_GT(blocks[i], blocks[i - 1]);
+        }
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 21);
+    ASSERT_FALSE(actual_blocks_state[20].is_block_occupied);
+    
+    std::reverse(blocks, blocks + 20);
+    allocator_instance->deallocate_batch(blocks, 20);
+    
+    void *oversized_blocks[10];
+    ASSERT_THROW(allocator_instance->allocate_batch(sizeof(unsigned char) * 1000, 10, oversized_blocks), std::bad_alloc);
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_FALSE(actual_blocks_state[0].is_block_occupied);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test14)
+{
+    allocator *allocator_instance = new allocator_sorted_list(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    auto *compacting_allocator = dynamic_cast<allocator_with_compaction *>(allocator_instance);
+    
+    allocator_with_compaction::handle_t handles[6];
+    
+    for (size_t i = 0; i < 6; ++i)
+    {
+        handles[i] = compacting_allocator->allocate_relocatable(sizeof(unsigned char), 100);
+        
+        auto *values = reinterpret_cast<unsigned char *>(compacting_allocator->lock(handles[i]));
+        std::fill(values, values + 100, static_cast<unsigned char>(i));
+        compacting_allocator->unlock(handles[i]);
+    }
+    
+    ASSERT_THROW(allocator_instance->deallocate(compacting_allocator->lock(handles[1])), std::logic_error);
+    compacting_allocator->unlock(handles[1]);
+    
+    compacting_allocator->deallocate_relocatable(handles[0]);
+    compacting_allocator->deallocate_relocatable(handles[2]);
+    compacting_allocator->deallocate_relocatable(handles[4]);
+    
+    void *pinned = compacting_allocator->lock(handles[3]);
+    
+    ASSERT_THROW(compacting_allocator->deallocate_relocatable(handles[3]), std::logic_error);
+    ASSERT_EQ(compacting_allocator->compact(1), 1);
+    ASSERT_EQ(compacting_allocator->compact(), 1);
+    ASSERT_EQ(compacting_allocator->lock(handles[3]), pinned);
+    compacting_allocator->unlock(handles[3]);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 5);
+    ASSERT_TRUE(actual_blocks_state[0].is_block_occupied);
+    ASSERT_FALSE(actual_blocks_state[1].is_block_occupied);
+    ASSERT_TRUE(actual_blocks_state[2].is_block_occupied);
+    ASSERT_TRUE(actual_blocks_state[3].is_block_occupied);
+    ASSERT_FALSE(actual_blocks_state[4].is_block_occupied);
+    
+    compacting_allocator->unlock(handles[3]);
+    
+    ASSERT_EQ(compacting_allocator->compact(), 2);
+    
+    actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance)->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 4);
+    ASSERT_FALSE(actual_blocks_state[3].is_block_occupied);
+    
+    for (size_t i: { 1, 3, 5 })
+    {
+        auto *values = reinterpret_cast<unsigned char *>(compacting_allocator->lock(handles[i]));
+        
+        ASSERT_TRUE(std::all_of(values, values + 100, [i](unsigned char value) { return value == i; }));
+        
+        compacting_allocator->unlock(handles[i]);
+        compacting_allocator->deallocate_relocatable(handles[i]);
+    }
+    
+    ASSERT_THROW(compacting_allocator->lock(handles[1]), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test15)
+{
+    allocator *allocator_instance = new allocator_sorted_list(1 << 18, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, std::vector<size_t>(),
+        trusted_memory_backing(trusted_memory_backing::kind::anonymous_mapping, 1 << 16));
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 40000));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 40000));
+    void *separator = allocator_instance->allocate(sizeof(unsigned char), 16);
+    
+    std::fill(first_block, first_block + 40000, 0xAB);
+    std::fill(second_block, second_block + 40000, 0xAB);
+    
+    allocator_instance->deallocate(first_block);
+    
+    ASSERT_NE(first_block[1 << 14], 0);
+    
+    allocator_instance->deallocate(second_block);
+    
+    ASSERT_EQ(first_block[1 << 14], 0);
+    ASSERT_EQ(second_block[1 << 14], 0);
+    
+    allocator_instance->deallocate(separator);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListPositiveTests, test16)
+{
+    allocator *allocator_instance = new allocator_sorted_list(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    std::vector<void *> blocks;
+    for (size_t size = 1; size <= 50; size += 7)
+    {
+        void *block = allocator_instance->allocate(sizeof(unsigned char), size);
+        
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t), 0);
+        
+        blocks.push_back(block);
+    }
+    
+    for (void *block: blocks)
+    {
+        allocator_instance->deallocate(block);
+    }
+    
+    delete allocator_instance;
+}
+
 TEST(allocatorSortedListNegativeTests, test1)
 {
     logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -262,6 +637,68 @@ TEST(allocatorSortedListNegativeTests, test1)
     delete logger;
 }
 
+TEST(allocatorSortedListNegativeTests, test2)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_sorted_list(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    std::fill(first_block, second_block, 0xCD);
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListNegativeTests, test3)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_sorted_list(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    std::fill(second_block, third_block, 0xCD);
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    delete allocator_instance;
+}
+
+TEST(allocatorSortedListNegativeTests, test4)
+{
+    if (!allocator_debug_mode::is_enabled())
+    {
+        GTEST_SKIP();
+    }
+    
+    allocator *allocator_instance = new allocator_sorted_list(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    
+    auto *first_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *second_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    auto *third_block = reinterpret_cast<unsigned char *>(allocator_instance->allocate(sizeof(unsigned char), 100));
+    
+    allocator_instance->deallocate(second_block);
+    second_block[32] = 0xCD;
+    
+    ASSERT_THROW(allocator_instance->deallocate(first_block), std::logic_error);
+    
+    allocator_instance->deallocate(third_block);
+    
+    delete allocator_instance;
+}
+
 int main(
     int argc,
     char **argv)
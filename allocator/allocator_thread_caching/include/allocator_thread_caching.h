@@ -0,0 +1,87 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_THREAD_CACHING_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_THREAD_CACHING_H
+
+#include <memory>
+#include <allocator_guardant.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_thread_caching final:
+    private allocator_guardant,
+    public allocator,
+    private logger_guardant,
+    private typename_holder
+{
+
+private:
+    
+    struct thread_cache;
+    
+    struct thread_caches_registry;
+    
+    struct shared_state;
+
+private:
+    
+    std::shared_ptr<shared_state> _state;
+
+public:
+    
+    explicit allocator_thread_caching(
+        allocator *underlying_allocator,
+        logger *logger = nullptr,
+        size_t magazine_capacity = 64,
+        size_t max_cached_block_size = 1024);
+    
+    ~allocator_thread_caching() override;
+    
+    allocator_thread_caching(
+        allocator_thread_caching const &other) = delete;
+    
+    allocator_thread_caching &operator=(
+        allocator_thread_caching const &other) = delete;
+    
+    allocator_thread_caching(
+        allocator_thread_caching &&other) noexcept;
+    
+    allocator_thread_caching &operator=(
+        allocator_thread_caching &&other) noexcept;
+
+public:
+    
+    using allocator::allocate;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    void deallocate(
+        void *at) override;
+
+public:
+    
+    void flush_current_thread_cache();
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    static constexpr size_t block_meta_size() noexcept;
+    
+    static constexpr size_t min_cached_block_size() noexcept;
+    
+    thread_cache &obtain_current_thread_cache() const;
+    
+};
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_THREAD_CACHING_H
\ No newline at end of file
@@ -0,0 +1,377 @@
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../include/allocator_thread_caching.h"
+
+struct allocator_thread_caching::thread_cache
+{
+
+    std::vector<std::vector<void *>> magazines;
+
+};
+
+struct allocator_thread_caching::shared_state
+{
+
+    allocator *underlying_allocator;
+
+    logger *target_logger;
+
+    size_t magazine_capacity;
+
+    size_t size_classes_count;
+
+    unsigned long long id;
+
+    std::mutex mutex;
+
+    std::unordered_set<thread_cache *> thread_caches;
+
+    void *allocate_block(
+        size_t size)
+    {
+        return underlying_allocator == nullptr
+            ? ::operator new(size)
+            : underlying_allocator->allocate(1, size);
+    }
+
+    void deallocate_block(
+        void *block)
+    {
+        underlying_allocator == nullptr
+            ? ::operator delete(block)
+            : underlying_allocator->deallocate(block);
+    }
+
+    void refill(
+        thread_cache &cache,
+        size_t size_class)
+    {
+        std::vector<void *> &magazine = cache.magazines[size_class];
+        size_t const blocks_to_fetch = magazine_capacity / 2 == 0
+            ? 1
+            : magazine_capacity / 2;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        while (magazine.size() < blocks_to_fetch)
+        {
+            void *block;
+
+            try
+            {
+                block = allocate_block(block_meta_size() + (min_cached_block_size() << size_class));
+            }
+            catch (std::bad_alloc const &)
+            {
+                if (magazine.empty())
+                {
+                    throw;
+                }
+
+                break;
+            }
+
+            *reinterpret_cast<size_t *>(block) = size_class;
+            magazine.push_back(block);
+        }
+    }
+
+    void drain(
+        thread_cache &cache,
+        size_t size_class,
+        size_t blocks_to_keep)
+    {
+        std::vector<void *> &magazine = cache.magazines[size_class];
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        while (magazine.size() > blocks_to_keep)
+        {
+            deallocate_block(magazine.back());
+            magazine.pop_back();
+        }
+    }
+
+    void release(
+        thread_cache &cache)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (auto &magazine: cache.magazines)
+        {
+            for (void *block: magazine)
+            {
+                deallocate_block(block);
+            }
+
+            magazine.clear();
+        }
+
+        thread_caches.erase(&cache);
+    }
+
+};
+
+struct allocator_thread_caching::thread_caches_registry
+{
+
+    struct entry
+    {
+
+        std::weak_ptr<shared_state> state;
+
+        std::unique_ptr<thread_cache> cache;
+
+    };
+
+    std::unordered_map<unsigned long long, entry> entries;
+
+    unsigned long long last_used_id = 0;
+
+    thread_cache *last_used_cache = nullptr;
+
+    ~thread_caches_registry()
+    {
+        for (auto &id_and_entry: entries)
+        {
+            std::shared_ptr<shared_state> state = id_and_entry.second.state.lock();
+
+            if (state != nullptr)
+            {
+                state->release(*id_and_entry.second.cache);
+            }
+        }
+    }
+
+};
+
+allocator_thread_caching::allocator_thread_caching(
+    allocator *underlying_allocator,
+    logger *logger,
+    size_t magazine_capacity,
+    size_t max_cached_block_size):
+    _state(std::make_shared<shared_state>())
+{
+    static std::atomic<unsigned long long> instances_count(0);
+
+    _state->underlying_allocator = underlying_allocator;
+    _state->target_logger = logger;
+    _state->magazine_capacity = magazine_capacity;
+    _state->size_classes_count = 0;
+    _state->id = ++instances_count;
+
+    if (magazine_capacity != 0)
+    {
+        while (max_cached_block_size >= (min_cached_block_size() << _state->size_classes_count))
+        {
+            ++_state->size_classes_count;
+        }
+    }
+
+    debug_with_guard(get_typename() + "::allocator_thread_caching(allocator *, logger *, size_t, size_t) : "
+        + std::to_string(_state->size_classes_count) + " size classes with magazines of "
+        + std::to_string(magazine_capacity) + " blocks");
+}
+
+allocator_thread_caching::~allocator_thread_caching()
+{
+    if (_state == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard(get_typename() + "::~allocator_thread_caching() : returning cached blocks to underlying allocator");
+
+    std::lock_guard<std::mutex> lock(_state->mutex);
+
+    for (thread_cache *cache: _state->thread_caches)
+    {
+        for (auto &magazine: cache->magazines)
+        {
+            for (void *block: magazine)
+            {
+                _state->deallocate_block(block);
+            }
+
+            magazine.clear();
+        }
+    }
+
+    _state->thread_caches.clear();
+}
+
+allocator_thread_caching::allocator_thread_caching(
+    allocator_thread_caching &&other) noexcept:
+    _state(std::move(other._state))
+{
+
+}
+
+allocator_thread_caching &allocator_thread_caching::operator=(
+    allocator_thread_caching &&other) noexcept
+{
+    if (this != &other)
+    {
+        std::swap(_state, other._state);
+    }
+
+    return *this;
+}
+
+[[nodiscard]] void *allocator_thread_caching::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    if (values_count != 0 && value_size > (std::numeric_limits<size_t>::max() - block_meta_size()) / values_count)
+    {
+        error_with_guard(get_typename() + "::allocate(size_t, size_t) : requested size overflows");
+
+        throw std::bad_alloc();
+    }
+
+    size_t const requested_size = value_size * values_count;
+
+    size_t size_class = 0;
+    while (size_class < _state->size_classes_count && (min_cached_block_size() << size_class) < requested_size)
+    {
+        ++size_class;
+    }
+
+    if (size_class == _state->size_classes_count)
+    {
+        void *block;
+
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            block = _state->allocate_block(block_meta_size() + requested_size);
+        }
+
+        *reinterpret_cast<size_t *>(block) = size_class;
+
+        return reinterpret_cast<unsigned char *>(block) + block_meta_size();
+    }
+
+    thread_cache &cache = obtain_current_thread_cache();
+    std::vector<void *> &magazine = cache.magazines[size_class];
+
+    if (magazine.empty())
+    {
+        _state->refill(cache, size_class);
+    }
+
+    void *block = magazine.back();
+    magazine.pop_back();
+
+    return reinterpret_cast<unsigned char *>(block) + block_meta_size();
+}
+
+void allocator_thread_caching::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    void *block = reinterpret_cast<unsigned char *>(at) - block_meta_size();
+    size_t const size_class = *reinterpret_cast<size_t *>(block);
+
+    if (size_class >= _state->size_classes_count)
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->deallocate_block(block);
+
+        return;
+    }
+
+    thread_cache &cache = obtain_current_thread_cache();
+    std::vector<void *> &magazine = cache.magazines[size_class];
+
+    magazine.push_back(block);
+
+    if (magazine.size() >= _state->magazine_capacity)
+    {
+        _state->drain(cache, size_class, _state->magazine_capacity / 2);
+    }
+}
+
+void allocator_thread_caching::flush_current_thread_cache()
+{
+    thread_cache &cache = obtain_current_thread_cache();
+
+    for (size_t size_class = 0; size_class < _state->size_classes_count; ++size_class)
+    {
+        _state->drain(cache, size_class, 0);
+    }
+}
+
+inline allocator *allocator_thread_caching::get_allocator() const
+{
+    return _state->underlying_allocator;
+}
+
+inline logger *allocator_thread_caching::get_logger() const
+{
+    return _state->target_logger;
+}
+
+inline std::string allocator_thread_caching::get_typename() const noexcept
+{
+    return "allocator_thread_caching";
+}
+
+constexpr size_t allocator_thread_caching::block_meta_size() noexcept
+{
+    return alignof(std::max_align_t);
+}
+
+constexpr size_t allocator_thread_caching::min_cached_block_size() noexcept
+{
+    return 16;
+}
+
+allocator_thread_caching::thread_cache &allocator_thread_caching::obtain_current_thread_cache() const
+{
+    static thread_local thread_caches_registry registry;
+
+    if (registry.last_used_id == _state->id)
+    {
+        return *registry.last_used_cache;
+    }
+
+    auto found = registry.entries.find(_state->id);
+
+    if (found == registry.entries.end())
+    {
+        for (auto it = registry.entries.begin(); it != registry.entries.end();)
+        {
+            it = it->second.state.expired()
+                ? registry.entries.erase(it)
+                : std::next(it);
+        }
+
+        std::unique_ptr<thread_cache> cache(new thread_cache);
+        cache->magazines.resize(_state->size_classes_count);
+        for (auto &magazine: cache->magazines)
+        {
+            magazine.reserve(_state->magazine_capacity);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            _state->thread_caches.insert(cache.get());
+        }
+
+        found = registry.entries.emplace(_state->id, thread_caches_registry::entry { _state, std::move(cache) }).first;
+    }
+
+    registry.last_used_id = _state->id;
+    registry.last_used_cache = found->second.cache.get();
+
+    return *registry.last_used_cache;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <allocator_sorted_list.h>
+#include <allocator_thread_caching.h>
+
+TEST(allocatorThreadCachingPositiveTests, test1)
+{
+    allocator *underlying_allocator = new allocator_sorted_list(10000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    allocator *subject = new allocator_thread_caching(underlying_allocator, nullptr, 8, 256);
+    
+    void *first_block = subject->allocate(sizeof(int), 10);
+    subject->deallocate(first_block);
+    void *second_block = subject->allocate(sizeof(char), 33);
+    
+    ASSERT_EQ(first_block, second_block);
+    
+    void *large_block = subject->allocate(sizeof(char), 1000);
+    subject->deallocate(large_block);
+    subject->deallocate(second_block);
+    
+    delete subject;
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(underlying_allocator)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+    
+    delete underlying_allocator;
+}
+
+TEST(allocatorThreadCachingPositiveTests, test2)
+{
+    allocator *underlying_allocator = new allocator_sorted_list(1 << 20, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit);
+    allocator *subject = new allocator_thread_caching(underlying_allocator, nullptr, 16, 512);
+    
+    int const threads_count = 8;
+    int const iterations_count = 2000;
+    std::vector<std::thread> threads;
+    
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back([subject, i]()
+        {
+            std::vector<unsigned char *> blocks;
+            
+            for (int j = 0; j < iterations_count; j++)
+            {
+                size_t const size = 1 + (i * 31 + j * 17) % 600;
+                auto *block = reinterpret_cast<unsigned char *>(subject->allocate(sizeof(unsigned char), size));
+                std::fill(block, block + size, static_cast<unsigned char>(i));
+                blocks.push_back(block);
+                
+                if (j % 3 == 2)
+                {
+                    for (auto *allocated_block: blocks)
+                    {
+                        ASSERT_EQ(*allocated_block, static_cast<unsigned char>(i));
+                        subject->deallocate(allocated_block);
+                    }
+                    
+                    blocks.clear();
+                }
+            }
+            
+            for (auto *allocated_block: blocks)
+            {
+                subject->deallocate(allocated_block);
+            }
+        });
+    }
+    
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    
+    delete subject;
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(underlying_allocator)->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0].is_block_occupied, false);
+    
+    delete underlying_allocator;
+}
+
+int main(
+    int argc,
+    char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    
+    return RUN_ALL_TESTS();
+}
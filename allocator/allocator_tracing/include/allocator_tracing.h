@@ -0,0 +1,149 @@
+#ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_TRACING_H
+#define MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_TRACING_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <allocator_guardant.h>
+#include <logger_guardant.h>
+#include <typename_holder.h>
+
+class allocator_tracing final:
+    private allocator_guardant,
+    public allocator,
+    private logger_guardant,
+    private typename_holder
+{
+
+public:
+    
+    enum class trace_operation: uint8_t
+    {
+        allocation,
+        deallocation,
+        expansion
+    };
+    
+    struct trace_record final
+    {
+        
+        uint64_t timestamp;
+        
+        uint64_t address;
+        
+        uint64_t value_size;
+        
+        uint64_t values_count;
+        
+        uint32_t thread_id;
+        
+        trace_operation operation;
+        
+        uint8_t reserved[3];
+        
+    };
+    
+    struct trace_file_header final
+    {
+        
+        char signature[8];
+        
+        uint32_t record_size;
+        
+        uint32_t reserved;
+        
+    };
+
+private:
+    
+    struct trace_buffer;
+    
+    struct trace_buffers_registry;
+    
+    struct shared_state;
+
+private:
+    
+    std::shared_ptr<shared_state> _state;
+
+public:
+    
+    explicit allocator_tracing(
+        allocator *underlying_allocator,
+        std::string const &trace_file_path,
+        logger *logger = nullptr,
+        size_t thread_buffer_capacity = 1 << 14,
+        std::chrono::milliseconds flush_interval = std::chrono::milliseconds(10));
+    
+    ~allocator_tracing() override;
+    
+    allocator_tracing(
+        allocator_tracing const &other) = delete;
+    
+    allocator_tracing &operator=(
+        allocator_tracing const &other) = delete;
+    
+    allocator_tracing(
+        allocator_tracing &&other) noexcept;
+    
+    allocator_tracing &operator=(
+        allocator_tracing &&other) noexcept;
+
+public:
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count) override;
+    
+    [[nodiscard]] void *allocate(
+        size_t value_size,
+        size_t values_count,
+        size_t alignment) override;
+    
+    void deallocate(
+        void *at) override;
+    
+    bool try_expand_in_place(
+        void *at,
+        size_t value_size,
+        size_t values_count) override;
+
+public:
+    
+    void flush();
+    
+    size_t get_dropped_records_count() const noexcept;
+    
+    static inline char const *trace_file_signature() noexcept;
+
+private:
+    
+    inline allocator *get_allocator() const override;
+
+private:
+    
+    inline logger *get_logger() const override;
+
+private:
+    
+    inline std::string get_typename() const noexcept override;
+
+private:
+    
+    void record(
+        trace_operation operation,
+        void *address,
+        size_t value_size,
+        size_t values_count) noexcept;
+    
+    trace_buffer &obtain_current_thread_buffer() const;
+    
+};
+
+inline char const *allocator_tracing::trace_file_signature() noexcept
+{
+    return "MPOSATR1";
+}
+
+#endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_ALLOCATOR_ALLOCATOR_TRACING_H
\ No newline at end of file
@@ -0,0 +1,408 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../include/allocator_tracing.h"
+
+struct allocator_tracing::trace_buffer
+{
+
+    std::unique_ptr<trace_record[]> records;
+
+    size_t capacity_mask;
+
+    uint32_t thread_id;
+
+    std::atomic<bool> is_retired;
+
+    std::atomic<size_t> head;
+
+    unsigned char head_padding[64 - sizeof(std::atomic<size_t>)];
+
+    std::atomic<size_t> tail;
+
+    bool try_push(
+        trace_record const &record) noexcept
+    {
+        size_t const current_head = head.load(std::memory_order_relaxed);
+
+        if (current_head - tail.load(std::memory_order_acquire) > capacity_mask)
+        {
+            return false;
+        }
+
+        records[current_head & capacity_mask] = record;
+        head.store(current_head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    void drain_to(
+        std::ofstream &stream) noexcept
+    {
+        size_t const current_tail = tail.load(std::memory_order_relaxed);
+        size_t const current_head = head.load(std::memory_order_acquire);
+
+        for (size_t position = current_tail; position != current_head;)
+        {
+            size_t const chunk_begin = position & capacity_mask;
+            size_t const chunk_size = std::min(current_head - position, capacity_mask + 1 - chunk_begin);
+
+            stream.write(reinterpret_cast<char const *>(records.get() + chunk_begin), static_cast<std::streamsize>(chunk_size * sizeof(trace_record)));
+            position += chunk_size;
+        }
+
+        tail.store(current_head, std::memory_order_release);
+    }
+
+};
+
+struct allocator_tracing::shared_state
+{
+
+    allocator *underlying_allocator;
+
+    logger *target_logger;
+
+    size_t thread_buffer_capacity;
+
+    std::chrono::milliseconds flush_interval;
+
+    std::chrono::steady_clock::time_point started_at;
+
+    unsigned long long id;
+
+    std::atomic<size_t> dropped_records_count;
+
+    std::mutex buffers_mutex;
+
+    std::vector<std::unique_ptr<trace_buffer>> buffers;
+
+    uint32_t last_thread_id;
+
+    std::mutex flush_mutex;
+
+    std::condition_variable flush_requested;
+
+    bool is_stopping;
+
+    std::ofstream stream;
+
+    std::thread flusher;
+
+    void drain_buffers()
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+
+        for (auto it = buffers.begin(); it != buffers.end();)
+        {
+            bool const is_retired = (*it)->is_retired.load(std::memory_order_acquire);
+            (*it)->drain_to(stream);
+
+            it = is_retired
+                ? buffers.erase(it)
+                : std::next(it);
+        }
+
+        stream.flush();
+    }
+
+    void run_flusher()
+    {
+        std::unique_lock<std::mutex> lock(flush_mutex);
+
+        while (!is_stopping)
+        {
+            flush_requested.wait_for(lock, flush_interval);
+            drain_buffers();
+        }
+    }
+
+};
+
+struct allocator_tracing::trace_buffers_registry
+{
+
+    struct entry
+    {
+
+        std::weak_ptr<shared_state> state;
+
+        trace_buffer *buffer;
+
+    };
+
+    std::unordered_map<unsigned long long, entry> entries;
+
+    unsigned long long last_used_id = 0;
+
+    trace_buffer *last_used_buffer = nullptr;
+
+    ~trace_buffers_registry()
+    {
+        for (auto &id_and_entry: entries)
+        {
+            std::shared_ptr<shared_state> state = id_and_entry.second.state.lock();
+
+            if (state != nullptr)
+            {
+                std::lock_guard<std::mutex> lock(state->buffers_mutex);
+                id_and_entry.second.buffer->is_retired.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+};
+
+allocator_tracing::allocator_tracing(
+    allocator *underlying_allocator,
+    std::string const &trace_file_path,
+    logger *logger,
+    size_t thread_buffer_capacity,
+    std::chrono::milliseconds flush_interval):
+    _state(std::make_shared<shared_state>())
+{
+    static std::atomic<unsigned long long> instances_count(0);
+
+    _state->underlying_allocator = underlying_allocator;
+    _state->target_logger = logger;
+    _state->thread_buffer_capacity = 1;
+    _state->flush_interval = flush_interval;
+    _state->started_at = std::chrono::steady_clock::now();
+    _state->id = ++instances_count;
+    _state->dropped_records_count = 0;
+    _state->last_thread_id = 0;
+    _state->is_stopping = false;
+
+    if (underlying_allocator == nullptr)
+    {
+        error_with_guard(get_typename() + "::allocator_tracing(allocator *, std::string const &, logger *, size_t, std::chrono::milliseconds) : underlying allocator is not specified");
+
+        throw std::logic_error("underlying allocator is not specified");
+    }
+
+    while (_state->thread_buffer_capacity < thread_buffer_capacity)
+    {
+        _state->thread_buffer_capacity <<= 1;
+    }
+
+    _state->stream.open(trace_file_path, std::ios::binary | std::ios::trunc);
+
+    if (!_state->stream.is_open())
+    {
+        error_with_guard(get_typename() + "::allocator_tracing(allocator *, std::string const &, logger *, size_t, std::chrono::milliseconds) : can't open trace file "
+            + trace_file_path);
+
+        throw std::runtime_error("can't open trace file " + trace_file_path);
+    }
+
+    trace_file_header header {};
+    std::memcpy(header.signature, trace_file_signature(), sizeof(header.signature));
+    header.record_size = sizeof(trace_record);
+    _state->stream.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+    _state->flusher = std::thread(&shared_state::run_flusher, _state.get());
+
+    debug_with_guard(get_typename() + "::allocator_tracing(allocator *, std::string const &, logger *, size_t, std::chrono::milliseconds) : tracing to "
+        + trace_file_path + " with " + std::to_string(_state->thread_buffer_capacity) + " records per thread buffer");
+}
+
+allocator_tracing::~allocator_tracing()
+{
+    if (_state == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_state->flush_mutex);
+        _state->is_stopping = true;
+    }
+
+    _state->flush_requested.notify_one();
+    _state->flusher.join();
+    _state->drain_buffers();
+
+    debug_with_guard(get_typename() + "::~allocator_tracing() : trace flushed, "
+        + std::to_string(_state->dropped_records_count.load()) + " records dropped");
+}
+
+allocator_tracing::allocator_tracing(
+    allocator_tracing &&other) noexcept:
+    _state(std::move(other._state))
+{
+
+}
+
+allocator_tracing &allocator_tracing::operator=(
+    allocator_tracing &&other) noexcept
+{
+    if (this != &other)
+    {
+        std::swap(_state, other._state);
+    }
+
+    return *this;
+}
+
+[[nodiscard]] void *allocator_tracing::allocate(
+    size_t value_size,
+    size_t values_count)
+{
+    void *result = _state->underlying_allocator->allocate(value_size, values_count);
+    record(trace_operation::allocation, result, value_size, values_count);
+
+    return result;
+}
+
+[[nodiscard]] void *allocator_tracing::allocate(
+    size_t value_size,
+    size_t values_count,
+    size_t alignment)
+{
+    void *result = _state->underlying_allocator->allocate(value_size, values_count, alignment);
+    record(trace_operation::allocation, result, value_size, values_count);
+
+    return result;
+}
+
+void allocator_tracing::deallocate(
+    void *at)
+{
+    if (at == nullptr)
+    {
+        return;
+    }
+
+    record(trace_operation::deallocation, at, 0, 0);
+    _state->underlying_allocator->deallocate(at);
+}
+
+bool allocator_tracing::try_expand_in_place(
+    void *at,
+    size_t value_size,
+    size_t values_count)
+{
+    if (!_state->underlying_allocator->try_expand_in_place(at, value_size, values_count))
+    {
+        return false;
+    }
+
+    record(trace_operation::expansion, at, value_size, values_count);
+
+    return true;
+}
+
+void allocator_tracing::flush()
+{
+    std::lock_guard<std::mutex> lock(_state->flush_mutex);
+    _state->drain_buffers();
+}
+
+size_t allocator_tracing::get_dropped_records_count() const noexcept
+{
+    return _state->dropped_records_count.load(std::memory_order_relaxed);
+}
+
+inline allocator *allocator_tracing::get_allocator() const
+{
+    return _state->underlying_allocator;
+}
+
+inline logger *allocator_tracing::get_logger() const
+{
+    return _state->target_logger;
+}
+
+inline std::string allocator_tracing::get_typename() const noexcept
+{
+    return "allocator_tracing";
+}
+
+void allocator_tracing::record(
+    trace_operation operation,
+    void *address,
+    size_t value_size,
+    size_t values_count) noexcept
+{
+    trace_buffer *buffer;
+
+    try
+    {
+        buffer = &obtain_current_thread_buffer();
+    }
+    catch (...)
+    {
+        _state->dropped_records_count.fetch_add(1, std::memory_order_relaxed);
+
+        return;
+    }
+
+    trace_record const record
+    {
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _state->started_at).count()),
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address)),
+        value_size,
+        values_count,
+        buffer->thread_id,
+        operation,
+        { 0, 0, 0 }
+    };
+
+    if (!buffer->try_push(record))
+    {
+        _state->dropped_records_count.fetch_add(1, std::memory_order_relaxed);
+        _state->flush_requested.notify_one();
+    }
+}
+
+allocator_tracing::trace_buffer &allocator_tracing::obtain_current_thread_buffer() const
+{
+    static thread_local trace_buffers_registry registry;
+
+    if (registry.last_used_id == _state->id)
+    {
+        return *registry.last_used_buffer;
+    }
+
+    auto found = registry.entries.find(_state->id);
+
+    if (found == registry.entries.end())
+    {
+        for (auto it = registry.entries.begin(); it != registry.entries.end();)
+        {
+            it = it->second.state.expired()
+                ? registry.entries.erase(it)
+                : std::next(it);
+        }
+
+        std::unique_ptr<trace_buffer> buffer(new trace_buffer);
+        buffer->records.reset(new trace_record[_state->thread_buffer_capacity]);
+        buffer->capacity_mask = _state->thread_buffer_capacity - 1;
+        buffer->is_retired = false;
+        buffer->head = 0;
+        buffer->tail = 0;
+
+        trace_buffer *registered_buffer = buffer.get();
+
+        {
+            std::lock_guard<std::mutex> lock(_state->buffers_mutex);
+            buffer->thread_id = ++_state->last_thread_id;
+            _state->buffers.push_back(std::move(buffer));
+        }
+
+        found = registry.entries.emplace(_state->id, trace_buffers_registry::entry { _state, registered_buffer }).first;
+    }
+
+    registry.last_used_id = _state->id;
+    registry.last_used_buffer = found->second.buffer;
+
+    return *registry.last_used_buffer;
+}
\ No newline at end of file
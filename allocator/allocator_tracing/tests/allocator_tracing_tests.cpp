@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <thread>
+#include <allocator_global_heap.h>
+#include <allocator_tracing.h>
+
+std::vector<allocator_tracing::trace_record> read_trace(
+    std::string const &path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    allocator_tracing::trace_file_header header {};
+    stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+    
+    EXPECT_EQ(std::memcmp(header.signature, allocator_tracing::trace_file_signature(), sizeof(header.signature)), 0);
+    EXPECT_EQ(header.record_size, sizeof(allocator_tracing::trace_record));
+    
+    std::vector<allocator_tracing::trace_record> records;
+    allocator_tracing::trace_record record {};
+    while (stream.read(reinterpret_cast<char *>(&record), sizeof(record)))
+    {
+        records.push_back(record);
+    }
+    
+    return records;
+}
+
+TEST(allocatorTracingPositiveTests, test1)
+{
+    std::string const trace_file_path = "allocator_tracing_test1.trace";
+    allocator *underlying_allocator = new allocator_global_heap();
+    allocator *subject = new allocator_tracing(underlying_allocator, trace_file_path);
+    
+    void *first_block = subject->allocate(sizeof(int), 10);
+    void *second_block = subject->allocate(sizeof(char), 33);
+    subject->deallocate(first_block);
+    void *third_block = subject->allocate(sizeof(double), 4, 64);
+    subject->deallocate(third_block);
+    subject->deallocate(second_block);
+    
+    delete subject;
+    delete underlying_allocator;
+    
+    auto records = read_trace(trace_file_path);
+    std::remove(trace_file_path.c_str());
+    
+    ASSERT_EQ(records.size(), 6);
+    
+    ASSERT_EQ(records[0].operation, allocator_tracing::trace_operation::allocation);
+    ASSERT_EQ(records[0].address, reinterpret_cast<uintptr_t>(first_block));
+    ASSERT_EQ(records[0].value_size, sizeof(int));
+    ASSERT_EQ(records[0].values_count, 10);
+    
+    ASSERT_EQ(records[2].operation, allocator_tracing::trace_operation::deallocation);
+    ASSERT_EQ(records[2].address, reinterpret_cast<uintptr_t>(first_block));
+    
+    ASSERT_EQ(records[3].address, reinterpret_cast<uintptr_t>(third_block));
+    ASSERT_EQ(records[3].values_count, 4);
+    
+    for (size_t i = 1; i < records.size(); ++i)
+    {
+        ASSERT_GE(records[i].timestamp, records[i - 1].timestamp);
+        ASSERT_EQ(records[i].thread_id, records[0].thread_id);
+    }
+}
+
+TEST(allocatorTracingPositiveTests, test2)
+{
+    std::string const trace_file_path = "allocator_tracing_test2.trace";
+    allocator *underlying_allocator = new allocator_global_heap();
+    auto *subject = new allocator_tracing(underlying_allocator, trace_file_path, nullptr, 1 << 12, std::chrono::milliseconds(1));
+    
+    int const threads_count = 4;
+    int const iterations_count = 5000;
+    std::vector<std::thread> threads;
+    
+    for (int i = 0; i < threads_count; i++)
+    {
+        threads.emplace_back([subject, i]()
+        {
+            for (int j = 0; j < iterations_count; j++)
+            {
+                void *block = subject->allocate(sizeof(char), 16 + (i * 31 + j) % 200);
+                subject->deallocate(block);
+            }
+        });
+    }
+    
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+    
+    subject->flush();
+    size_t const dropped_records_count = subject->get_dropped_records_count();
+    
+    delete subject;
+    delete underlying_allocator;
+    
+    auto records = read_trace(trace_file_path);
+    std::remove(trace_file_path.c_str());
+    
+    std::set<uint32_t> thread_ids;
+    for (auto const &record: records)
+    {
+        thread_ids.insert(record.thread_id);
+    }
+    
+    ASSERT_EQ(records.size() + dropped_records_count, 2 * threads_count * iterations_count);
+    ASSERT_EQ(thread_ids.size(), threads_count);
+}
+
+TEST(allocatorTracingNegativeTests, test1)
+{
+    ASSERT_THROW(allocator_tracing(nullptr, "allocator_tracing_negative_test1.trace"), std::logic_error);
+}
\ No newline at end of file
@@ -0,0 +1,648 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <allocator.h>
+#include <allocator_arena.h>
+#include <allocator_boundary_tags.h>
+#include <allocator_buddies_system.h>
+#include <allocator_buddies_system_concurrent.h>
+#include <allocator_global_heap.h>
+#include <allocator_pool.h>
+#include <allocator_red_black_tree.h>
+#include <allocator_slab.h>
+#include <allocator_sorted_list.h>
+#include <allocator_thread_caching.h>
+#include <allocator_tracing.h>
+#include <allocator_with_fit_mode.h>
+#include <allocator_with_statistics.h>
+
+namespace
+{
+
+    struct trace_operation final
+    {
+
+        size_t block_index;
+
+        size_t block_size;
+
+        bool is_allocation;
+
+    };
+
+    struct allocation_trace final
+    {
+
+        std::string name;
+
+        std::vector<trace_operation> operations;
+
+        size_t blocks_count;
+
+        size_t peak_live_bytes;
+
+        size_t peak_live_blocks_count;
+
+        size_t peak_operation_index;
+
+        size_t max_block_size;
+
+    };
+
+    class allocation_trace_builder final
+    {
+
+    private:
+
+        allocation_trace _trace;
+
+        std::vector<size_t> _block_sizes;
+
+        std::vector<bool> _is_block_live;
+
+        size_t _live_bytes;
+
+        size_t _live_blocks_count;
+
+    public:
+
+        explicit allocation_trace_builder(
+            std::string const &name):
+            _trace { name, {}, 0, 0, 0, 0, 0 },
+            _live_bytes(0),
+            _live_blocks_count(0)
+        {
+
+        }
+
+    public:
+
+        size_t allocate(
+            size_t block_size)
+        {
+            size_t const block_index = _trace.blocks_count++;
+
+            _trace.operations.push_back({ block_index, block_size, true });
+            _block_sizes.push_back(block_size);
+            _is_block_live.push_back(true);
+            _live_bytes += block_size;
+            ++_live_blocks_count;
+
+            if (_live_bytes > _trace.peak_live_bytes)
+            {
+                _trace.peak_live_bytes = _live_bytes;
+                _trace.peak_operation_index = _trace.operations.size() - 1;
+            }
+
+            _trace.peak_live_blocks_count = std::max(_trace.peak_live_blocks_count, _live_blocks_count);
+            _trace.max_block_size = std::max(_trace.max_block_size, block_size);
+
+            return block_index;
+        }
+
+        void deallocate(
+            size_t block_index)
+        {
+            if (block_index >= _is_block_live.size() || !_is_block_live[block_index])
+            {
+                throw std::invalid_argument("trace deallocates block which is not live");
+            }
+
+            _trace.operations.push_back({ block_index, _block_sizes[block_index], false });
+            _is_block_live[block_index] = false;
+            _live_bytes -= _block_sizes[block_index];
+            --_live_blocks_count;
+        }
+
+        size_t operations_count() const noexcept
+        {
+            return _trace.operations.size();
+        }
+
+        allocation_trace build()
+        {
+            for (size_t block_index = 0; block_index < _is_block_live.size(); ++block_index)
+            {
+                if (_is_block_live[block_index])
+                {
+                    deallocate(block_index);
+                }
+            }
+
+            return std::move(_trace);
+        }
+
+    };
+
+    constexpr size_t synthetic_trace_operations_count = 1 << 15;
+
+    constexpr size_t synthetic_trace_live_blocks_count = 512;
+
+    template<
+        typename block_size_distribution>
+    allocation_trace build_random_lifetimes_trace(
+        std::string const &name,
+        block_size_distribution distribution)
+    {
+        allocation_trace_builder builder(name);
+        std::mt19937_64 engine(42);
+        std::vector<size_t> live_blocks;
+
+        while (builder.operations_count() < synthetic_trace_operations_count)
+        {
+            if (live_blocks.empty() || engine() % (2 * synthetic_trace_live_blocks_count) >= live_blocks.size())
+            {
+                live_blocks.push_back(builder.allocate(distribution(engine)));
+
+                continue;
+            }
+
+            size_t const victim = engine() % live_blocks.size();
+            builder.deallocate(live_blocks[victim]);
+            live_blocks[victim] = live_blocks.back();
+            live_blocks.pop_back();
+        }
+
+        return builder.build();
+    }
+
+    allocation_trace build_uniform_trace()
+    {
+        std::uniform_int_distribution<size_t> distribution(8, 1024);
+
+        return build_random_lifetimes_trace("uniform", distribution);
+    }
+
+    allocation_trace build_power_law_trace()
+    {
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+        return build_random_lifetimes_trace("power_law", [&distribution](std::mt19937_64 &engine)
+        {
+            double const block_size = 16.0 / std::pow(1.0 - distribution(engine), 1.0 / 1.2);
+
+            return static_cast<size_t>(std::min(block_size, 65536.0));
+        });
+    }
+
+    allocation_trace build_producer_consumer_trace()
+    {
+        constexpr size_t burst_size = 64;
+
+        allocation_trace_builder builder("producer_consumer");
+        std::mt19937_64 engine(42);
+        std::uniform_int_distribution<size_t> distribution(64, 512);
+        std::deque<size_t> queue;
+
+        while (builder.operations_count() < synthetic_trace_operations_count)
+        {
+            for (size_t i = 0; i < burst_size; ++i)
+            {
+                queue.push_back(builder.allocate(distribution(engine)));
+            }
+
+            while (queue.size() > 2 * synthetic_trace_live_blocks_count - burst_size)
+            {
+                builder.deallocate(queue.front());
+                queue.pop_front();
+            }
+        }
+
+        return builder.build();
+    }
+
+    allocation_trace load_text_trace(
+        std::istream &stream,
+        std::string const &path,
+        allocation_trace_builder &builder)
+    {
+        std::unordered_map<std::string, size_t> block_indices;
+        std::string line;
+
+        for (size_t line_number = 1; std::getline(stream, line); ++line_number)
+        {
+            std::istringstream line_stream(line);
+            std::string operation;
+            std::string block_id;
+            size_t block_size;
+
+            if (!(line_stream >> operation) || operation[0] == '#')
+            {
+                continue;
+            }
+
+            if (operation == "a" && line_stream >> block_id >> block_size && block_indices.count(block_id) == 0)
+            {
+                block_indices.emplace(block_id, builder.allocate(block_size));
+
+                continue;
+            }
+
+            if (operation == "d" && line_stream >> block_id && block_indices.count(block_id) != 0)
+            {
+                builder.deallocate(block_indices[block_id]);
+                block_indices.erase(block_id);
+
+                continue;
+            }
+
+            throw std::runtime_error(path + ":" + std::to_string(line_number) + " : malformed allocation trace record");
+        }
+
+        return builder.build();
+    }
+
+    allocation_trace load_binary_trace(
+        std::istream &stream,
+        allocation_trace_builder &builder)
+    {
+        std::vector<allocator_tracing::trace_record> records;
+        allocator_tracing::trace_record record {};
+
+        while (stream.read(reinterpret_cast<char *>(&record), sizeof(record)))
+        {
+            records.push_back(record);
+        }
+
+        std::stable_sort(records.begin(), records.end(), [](allocator_tracing::trace_record const &left, allocator_tracing::trace_record const &right)
+        {
+            return left.timestamp < right.timestamp;
+        });
+
+        std::unordered_map<uint64_t, size_t> block_indices;
+
+        for (auto const &traced: records)
+        {
+            auto const block_index = block_indices.find(traced.address);
+
+            if (traced.operation != allocator_tracing::trace_operation::allocation && block_index != block_indices.end())
+            {
+                builder.deallocate(block_index->second);
+                block_indices.erase(block_index);
+            }
+
+            if (traced.operation != allocator_tracing::trace_operation::deallocation)
+            {
+                block_indices[traced.address] = builder.allocate(traced.value_size * traced.values_count);
+            }
+        }
+
+        return builder.build();
+    }
+
+    allocation_trace load_trace(
+        std::string const &path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+
+        if (!stream.is_open())
+        {
+            throw std::runtime_error("can't open allocation trace file " + path);
+        }
+
+        allocation_trace_builder builder("trace:" + path.substr(path.find_last_of('/') + 1));
+        allocator_tracing::trace_file_header header {};
+
+        if (stream.read(reinterpret_cast<char *>(&header), sizeof(header))
+            && std::memcmp(header.signature, allocator_tracing::trace_file_signature(), sizeof(header.signature)) == 0)
+        {
+            if (header.record_size != sizeof(allocator_tracing::trace_record))
+            {
+                throw std::runtime_error(path + " : unsupported allocation trace record size");
+            }
+
+            return load_binary_trace(stream, builder);
+        }
+
+        stream.clear();
+        stream.seekg(0);
+
+        return load_text_trace(stream, path, builder);
+    }
+
+    struct benchmark_subject final
+    {
+
+        std::string name;
+
+        std::function<std::shared_ptr<allocator>(size_t, size_t)> create;
+
+        std::function<void(allocator &)> rewind;
+
+    };
+
+    template<
+        typename allocator_factory>
+    void add_fit_mode_subjects(
+        std::vector<benchmark_subject> &subjects,
+        std::string const &name,
+        allocator_factory create)
+    {
+        std::pair<allocator_with_fit_mode::fit_mode, char const *> const fit_modes[] =
+        {
+            { allocator_with_fit_mode::fit_mode::first_fit, "first_fit" },
+            { allocator_with_fit_mode::fit_mode::the_best_fit, "the_best_fit" },
+            { allocator_with_fit_mode::fit_mode::the_worst_fit, "the_worst_fit" }
+        };
+
+        for (auto const &fit_mode: fit_modes)
+        {
+            auto const mode = fit_mode.first;
+
+            subjects.push_back({ name + "/" + fit_mode.second, [create, mode](size_t space_size, size_t)
+            {
+                return std::shared_ptr<allocator>(create(space_size, mode));
+            }, nullptr });
+        }
+    }
+
+    size_t obtain_space_size_power_of_two(
+        size_t space_size) noexcept
+    {
+        size_t space_size_power_of_two = 0;
+        while ((static_cast<size_t>(1) << space_size_power_of_two) < space_size)
+        {
+            ++space_size_power_of_two;
+        }
+
+        return space_size_power_of_two;
+    }
+
+    std::vector<benchmark_subject> create_subjects()
+    {
+        std::vector<benchmark_subject> subjects;
+
+        add_fit_mode_subjects(subjects, "sorted_list", [](size_t space_size, allocator_with_fit_mode::fit_mode mode) -> allocator *
+        {
+            return new allocator_sorted_list(space_size, nullptr, nullptr, mode);
+        });
+        add_fit_mode_subjects(subjects, "boundary_tags", [](size_t space_size, allocator_with_fit_mode::fit_mode mode) -> allocator *
+        {
+            return new allocator_boundary_tags(space_size, nullptr, nullptr, mode);
+        });
+        add_fit_mode_subjects(subjects, "red_black_tree", [](size_t space_size, allocator_with_fit_mode::fit_mode mode) -> allocator *
+        {
+            return new allocator_red_black_tree(space_size, nullptr, nullptr, mode);
+        });
+        add_fit_mode_subjects(subjects, "buddies_system", [](size_t space_size, allocator_with_fit_mode::fit_mode mode) -> allocator *
+        {
+            return new allocator_buddies_system(obtain_space_size_power_of_two(space_size), nullptr, nullptr, mode);
+        });
+        add_fit_mode_subjects(subjects, "buddies_system_concurrent", [](size_t space_size, allocator_with_fit_mode::fit_mode mode) -> allocator *
+        {
+            return new allocator_buddies_system_concurrent(obtain_space_size_power_of_two(space_size), nullptr, nullptr, mode);
+        });
+
+        subjects.push_back({ "slab", [](size_t, size_t)
+        {
+            return std::shared_ptr<allocator>(new allocator_slab());
+        }, nullptr });
+
+        subjects.push_back({ "global_heap", [](size_t, size_t)
+        {
+            return std::shared_ptr<allocator>(new allocator_global_heap());
+        }, nullptr });
+
+        // arena never reuses freed blocks, so it is reset after every trace replay
+        subjects.push_back({ "arena", [](size_t space_size, size_t)
+        {
+            return std::shared_ptr<allocator>(new allocator_arena(space_size));
+        }, [](allocator &subject_instance)
+        {
+            static_cast<allocator_arena &>(subject_instance).reset();
+        } });
+
+        // pool slots fit the largest block of the trace
+        subjects.push_back({ "pool", [](size_t, size_t max_block_size)
+        {
+            return std::shared_ptr<allocator>(new allocator_pool(std::max<size_t>(max_block_size, 1)));
+        }, nullptr });
+
+        subjects.push_back({ "thread_caching/boundary_tags", [](size_t space_size, size_t)
+        {
+            std::unique_ptr<allocator> underlying_allocator(new allocator_boundary_tags(space_size));
+            std::shared_ptr<allocator> subject_instance(new allocator_thread_caching(underlying_allocator.get()),
+                [underlying = underlying_allocator.get()](allocator *thread_caching)
+                {
+                    delete thread_caching;
+                    delete underlying;
+                });
+            underlying_allocator.release();
+
+            return subject_instance;
+        }, nullptr });
+
+        return subjects;
+    }
+
+    void reset_peak_resident_set_size()
+    {
+        std::ofstream("/proc/self/clear_refs") << "5";
+    }
+
+    double obtain_peak_resident_set_size_kib()
+    {
+        std::ifstream status("/proc/self/status");
+
+        for (std::string line; std::getline(status, line);)
+        {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+            {
+                return std::stod(line.substr(6));
+            }
+        }
+
+        return 0;
+    }
+
+    constexpr size_t latency_sampling_passes_count = 4;
+
+    double obtain_percentile_ns(
+        std::vector<std::chrono::nanoseconds::rep> const &sorted_samples,
+        double fraction) noexcept
+    {
+        if (sorted_samples.empty())
+        {
+            return 0;
+        }
+
+        return static_cast<double>(sorted_samples[std::min(sorted_samples.size() - 1, static_cast<size_t>(fraction * static_cast<double>(sorted_samples.size())))]);
+    }
+
+    void replay_trace(
+        benchmark::State &state,
+        allocation_trace const &trace,
+        benchmark_subject const &subject)
+    {
+        size_t const space_size = 2 * trace.peak_live_bytes + 64 * trace.peak_live_blocks_count + (1 << 16);
+
+        reset_peak_resident_set_size();
+
+        std::shared_ptr<allocator> const subject_instance = subject.create(space_size, trace.max_block_size);
+        auto const *statistics_source = dynamic_cast<allocator_with_statistics const *>(subject_instance.get());
+
+        std::vector<void *> blocks(trace.blocks_count);
+        size_t failed_allocations_count = 0;
+
+        // throughput pass: no per operation timing, so items_per_second covers allocator work only
+        for (auto _: state)
+        {
+            for (auto const &operation: trace.operations)
+            {
+                if (!operation.is_allocation)
+                {
+                    subject_instance->deallocate(blocks[operation.block_index]);
+
+                    continue;
+                }
+
+                try
+                {
+                    blocks[operation.block_index] = subject_instance->allocate(1, operation.block_size);
+                }
+                catch (std::bad_alloc const &)
+                {
+                    blocks[operation.block_index] = nullptr;
+                    ++failed_allocations_count;
+                }
+            }
+
+            if (subject.rewind)
+            {
+                subject.rewind(*subject_instance);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trace.operations.size()));
+        state.counters["failed_allocations"] = benchmark::Counter(static_cast<double>(failed_allocations_count), benchmark::Counter::kAvgIterations);
+
+        // latency pass: every operation is timed separately and percentiles are taken from the exact sorted samples
+        std::vector<std::chrono::nanoseconds::rep> allocate_latencies;
+        std::vector<std::chrono::nanoseconds::rep> deallocate_latencies;
+        allocate_latencies.reserve(latency_sampling_passes_count * trace.blocks_count);
+        deallocate_latencies.reserve(latency_sampling_passes_count * trace.blocks_count);
+        double fragmentation_sum = 0;
+
+        for (size_t pass = 0; pass < latency_sampling_passes_count; ++pass)
+        {
+            for (size_t i = 0; i < trace.operations.size(); ++i)
+            {
+                trace_operation const &operation = trace.operations[i];
+                auto const started_at = std::chrono::steady_clock::now();
+
+                if (operation.is_allocation)
+                {
+                    try
+                    {
+                        blocks[operation.block_index] = subject_instance->allocate(1, operation.block_size);
+                    }
+                    catch (std::bad_alloc const &)
+                    {
+                        blocks[operation.block_index] = nullptr;
+                    }
+
+                    allocate_latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started_at).count());
+                }
+                else
+                {
+                    subject_instance->deallocate(blocks[operation.block_index]);
+                    deallocate_latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started_at).count());
+                }
+
+                if (i == trace.peak_operation_index && statistics_source != nullptr)
+                {
+                    fragmentation_sum += statistics_source->get_statistics().external_fragmentation;
+                }
+            }
+
+            if (subject.rewind)
+            {
+                subject.rewind(*subject_instance);
+            }
+        }
+
+        std::sort(allocate_latencies.begin(), allocate_latencies.end());
+        std::sort(deallocate_latencies.begin(), deallocate_latencies.end());
+
+        state.counters["allocate_p50_ns"] = obtain_percentile_ns(allocate_latencies, 0.5);
+        state.counters["allocate_p99_ns"] = obtain_percentile_ns(allocate_latencies, 0.99);
+        state.counters["allocate_p999_ns"] = obtain_percentile_ns(allocate_latencies, 0.999);
+        state.counters["deallocate_p50_ns"] = obtain_percentile_ns(deallocate_latencies, 0.5);
+        state.counters["deallocate_p99_ns"] = obtain_percentile_ns(deallocate_latencies, 0.99);
+        state.counters["peak_rss_kib"] = obtain_peak_resident_set_size_kib();
+
+        if (statistics_source != nullptr)
+        {
+            state.counters["fragmentation"] = fragmentation_sum / latency_sampling_passes_count;
+        }
+    }
+
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+
+    std::vector<allocation_trace> traces;
+    traces.push_back(build_uniform_trace());
+    traces.push_back(build_power_law_trace());
+    traces.push_back(build_producer_consumer_trace());
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string const argument = argv[i];
+
+        if (argument.compare(0, 8, "--trace=") != 0)
+        {
+            std::cerr << "unrecognized argument " << argument << std::endl
+                << "usage: " << argv[0] << " [benchmark flags] [--trace=<allocation trace file>]..." << std::endl;
+
+            return 1;
+        }
+
+        try
+        {
+            traces.push_back(load_trace(argument.substr(8)));
+        }
+        catch (std::exception const &error)
+        {
+            std::cerr << error.what() << std::endl;
+
+            return 1;
+        }
+    }
+
+    std::vector<benchmark_subject> const subjects = create_subjects();
+
+    for (auto const &trace: traces)
+    {
+        for (auto const &subject: subjects)
+        {
+            benchmark::RegisterBenchmark((trace.name + "/" + subject.name).c_str(), [&trace, &subject](benchmark::State &state)
+            {
+                replay_trace(state, trace, subject);
+            })->Unit(benchmark::kMicrosecond);
+        }
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include <allocator.h>
+#include <allocator_red_black_tree.h>
+
+namespace
+{
+
+    size_t block_size_by_index(
+        size_t index)
+    {
+        return 32 + index * 7919 % 64;
+    }
+
+}
+
+static void allocate_with_fragmented_free_tree(
+    benchmark::State &state)
+{
+    size_t const free_blocks_count = static_cast<size_t>(state.range(0));
+    auto const fit_mode = static_cast<allocator_with_fit_mode::fit_mode>(state.range(1));
+
+    allocator_red_black_tree subject(free_blocks_count * 2 * 128 + (1 << 16), nullptr, nullptr, fit_mode);
+
+    std::vector<void *> blocks(free_blocks_count * 2);
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        blocks[i] = subject.allocate(1, block_size_by_index(i));
+    }
+
+    for (size_t i = 0; i < blocks.size(); i += 2)
+    {
+        subject.deallocate(blocks[i]);
+    }
+
+    std::mt19937 engine(42);
+    std::vector<size_t> requested_sizes(1 << 12);
+    for (auto &requested_size: requested_sizes)
+    {
+        requested_size = block_size_by_index(engine());
+    }
+
+    size_t iteration = 0;
+    for (auto _: state)
+    {
+        void *block = subject.allocate(1, requested_sizes[iteration++ & (requested_sizes.size() - 1)]);
+        benchmark::DoNotOptimize(block);
+        subject.deallocate(block);
+    }
+
+    state.counters["free_blocks"] = static_cast<double>(free_blocks_count);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(allocate_with_fragmented_free_tree)
+    ->ArgNames({ "free_blocks", "fit_mode" })
+    ->ArgsProduct({ benchmark::CreateRange(100, 1000000, 10), { 0, 1, 2 } });
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -1,6 +1,12 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_H
 
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
 #include <logger.h>
 #include "client_logger_builder.h"
 
@@ -8,6 +14,56 @@ class client_logger final:
     public logger
 {
 
+    friend class client_logger_builder;
+
+private:
+
+    struct stream final
+    {
+
+        std::string file_path;
+
+        std::shared_ptr<std::ostream> target;
+
+        std::shared_ptr<std::mutex> target_mutex;
+
+        unsigned char severities_mask;
+
+    };
+
+    static constexpr size_t severities_count = 6;
+
+    static constexpr logger::severity flush_severity = logger::severity::warning;
+
+    using routing_table = std::array<std::vector<size_t>, severities_count>;
+
+    struct file_stream;
+
+    struct file_streams_registry;
+
+    class async_writer;
+
+private:
+
+    std::vector<stream> _streams;
+
+    routing_table _routes;
+
+    size_t _minimum_enabled_severity_index;
+
+    logger::datetime_precision _datetime_precision;
+
+    std::shared_ptr<async_writer> _async_writer;
+
+private:
+
+    client_logger(
+        std::map<std::string, std::set<logger::severity>> const &file_streams,
+        std::set<logger::severity> const &console_stream_severities,
+        size_t async_queue_capacity,
+        client_logger_builder::overflow_policy async_overflow_policy,
+        logger::datetime_precision datetime_precision);
+
 public:
 
     client_logger(
@@ -30,6 +86,31 @@ public:
         const std::string &message,
         logger::severity severity) const noexcept override;
 
+    bool is_severity_enabled(
+        logger::severity severity) const noexcept override;
+
+private:
+
+    static std::shared_ptr<file_stream> obtain_file_stream(
+        std::string const &file_path);
+
+    static file_streams_registry &obtain_file_streams_registry();
+
+    static std::shared_ptr<std::mutex> const &obtain_console_mutex();
+
+private:
+
+    void build_routes();
+
+    static inline size_t obtain_severity_index(
+        logger::severity severity) noexcept;
+
+    static inline unsigned char obtain_severities_mask(
+        std::set<logger::severity> const &severities) noexcept;
+
+    static inline unsigned char obtain_severity_bit(
+        logger::severity severity) noexcept;
+
 };
 
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_H
\ No newline at end of file
@@ -1,12 +1,35 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_BUILDER_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_CLIENT_LOGGER_BUILDER_H
 
+#include <map>
+#include <set>
 #include <logger_builder.h>
 
 class client_logger_builder final:
     public logger_builder
 {
 
+public:
+
+    enum class overflow_policy
+    {
+        block,
+        drop_oldest,
+        drop_newest
+    };
+
+private:
+
+    std::map<std::string, std::set<logger::severity>> _file_streams;
+
+    std::set<logger::severity> _console_stream_severities;
+
+    size_t _async_queue_capacity;
+
+    overflow_policy _async_overflow_policy;
+
+    logger::datetime_precision _datetime_precision;
+
 public:
 
     client_logger_builder();
@@ -40,6 +63,13 @@ public:
 
     logger_builder *clear() override;
 
+    client_logger_builder *set_async_mode(
+        size_t queue_capacity,
+        overflow_policy policy = overflow_policy::block);
+
+    client_logger_builder *set_datetime_precision(
+        logger::datetime_precision precision);
+
     [[nodiscard]] logger *build() const override;
 
 };
@@ -1,39 +1,583 @@
-#include <not_implemented.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
 
 #include "../include/client_logger.h"
 
-client_logger::client_logger(
-    client_logger const &other)
+struct client_logger::file_stream final
+{
+
+    static constexpr size_t buffer_size = 1 << 16;
+
+    std::mutex mutex;
+
+    std::unique_ptr<char[]> buffer;
+
+    std::ofstream target;
+
+};
+
+struct client_logger::file_streams_registry final
+{
+
+    std::mutex mutex;
+
+    std::map<std::string, std::weak_ptr<file_stream>> streams;
+
+};
+
+class client_logger::async_writer final
+{
+
+private:
+
+    struct record final
+    {
+
+        std::string text;
+
+        size_t severity_index;
+
+    };
+
+    struct cell final
+    {
+
+        std::atomic<size_t> sequence;
+
+        record value;
+
+    };
+
+private:
+
+    static constexpr size_t max_batch_size = 256;
+
+    static constexpr size_t cache_line_size = 64;
+
+private:
+
+    std::vector<stream> _streams;
+
+    routing_table _routes;
+
+    client_logger_builder::overflow_policy _overflow_policy;
+
+    std::unique_ptr<cell[]> _cells;
+
+    size_t _positions_mask;
+
+    std::atomic<size_t> _enqueue_position;
+
+    unsigned char _positions_padding[cache_line_size];
+
+    std::atomic<size_t> _dequeue_position;
+
+    std::atomic<bool> _is_writer_waiting;
+
+    std::atomic<bool> _is_stopping;
+
+    std::mutex _wakeup_mutex;
+
+    std::condition_variable _wakeup;
+
+    std::thread _writer;
+
+public:
+
+    async_writer(
+        std::vector<stream> const &streams,
+        routing_table const &routes,
+        size_t queue_capacity,
+        client_logger_builder::overflow_policy overflow_policy);
+
+    ~async_writer() noexcept;
+
+    async_writer(
+        async_writer const &other) = delete;
+
+    async_writer &operator=(
+        async_writer const &other) = delete;
+
+public:
+
+    void push(
+        std::string &&text,
+        size_t severity_index);
+
+private:
+
+    bool try_push(
+        record &value);
+
+    bool try_pop(
+        record &value);
+
+    bool has_pending_records() const noexcept;
+
+    void wake_writer();
+
+    void drain();
+
+    void write_batch(
+        std::vector<record> const &batch);
+
+};
+
+client_logger::async_writer::async_writer(
+    std::vector<stream> const &streams,
+    routing_table const &routes,
+    size_t queue_capacity,
+    client_logger_builder::overflow_policy overflow_policy):
+    _streams(streams),
+    _routes(routes),
+    _overflow_policy(overflow_policy),
+    _enqueue_position(0),
+    _dequeue_position(0),
+    _is_writer_waiting(false),
+    _is_stopping(false)
 {
-    throw not_implemented("client_logger::client_logger(client_logger const &other)", "your code should be here...");
+    // a single cell cannot tell a filled slot from a free one of the next lap, so the ring holds at least two
+    size_t cells_count = 2;
+
+    while (cells_count < queue_capacity)
+    {
+        cells_count <<= 1;
+    }
+
+    _cells.reset(new cell[cells_count]);
+    _positions_mask = cells_count - 1;
+
+    for (size_t i = 0; i < cells_count; ++i)
+    {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    _writer = std::thread(&async_writer::drain, this);
 }
 
-client_logger &client_logger::operator=(
-    client_logger const &other)
+client_logger::async_writer::~async_writer() noexcept
+{
+    _is_stopping.store(true);
+    wake_writer();
+    _writer.join();
+}
+
+void client_logger::async_writer::push(
+    std::string &&text,
+    size_t severity_index)
+{
+    record value { std::move(text), severity_index };
+
+    switch (_overflow_policy)
+    {
+        case client_logger_builder::overflow_policy::block:
+            while (!try_push(value))
+            {
+                wake_writer();
+                std::this_thread::yield();
+            }
+            break;
+        case client_logger_builder::overflow_policy::drop_oldest:
+            while (!try_push(value))
+            {
+                record oldest;
+                try_pop(oldest);
+            }
+            break;
+        case client_logger_builder::overflow_policy::drop_newest:
+            if (!try_push(value))
+            {
+                return;
+            }
+            break;
+    }
+
+    if (_is_writer_waiting.load())
+    {
+        wake_writer();
+    }
+}
+
+bool client_logger::async_writer::try_push(
+    record &value)
+{
+    size_t position = _enqueue_position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell &target = _cells[position & _positions_mask];
+        size_t const sequence = target.sequence.load(std::memory_order_acquire);
+        auto const difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference < 0)
+        {
+            return false;
+        }
+
+        if (difference > 0)
+        {
+            position = _enqueue_position.load(std::memory_order_relaxed);
+        }
+        else if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            target.value = std::move(value);
+            target.sequence.store(position + 1, std::memory_order_release);
+
+            return true;
+        }
+    }
+}
+
+bool client_logger::async_writer::try_pop(
+    record &value)
+{
+    size_t position = _dequeue_position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        cell &source = _cells[position & _positions_mask];
+        size_t const sequence = source.sequence.load(std::memory_order_acquire);
+        auto const difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+        if (difference < 0)
+        {
+            return false;
+        }
+
+        if (difference > 0)
+        {
+            position = _dequeue_position.load(std::memory_order_relaxed);
+        }
+        else if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+            value = std::move(source.value);
+            source.sequence.store(position + _positions_mask + 1, std::memory_order_release);
+
+            return true;
+        }
+    }
+}
+
+bool client_logger::async_writer::has_pending_records() const noexcept
+{
+    return _enqueue_position.load() != _dequeue_position.load();
+}
+
+void client_logger::async_writer::wake_writer()
 {
-    throw not_implemented("client_logger &client_logger::operator=(client_logger const &other)", "your code should be here...");
+    std::lock_guard<std::mutex> lock(_wakeup_mutex);
+    _wakeup.notify_one();
+}
+
+void client_logger::async_writer::drain()
+{
+    std::vector<record> batch;
+    batch.reserve(max_batch_size);
+
+    while (true)
+    {
+        for (record value; batch.size() < max_batch_size && try_pop(value);)
+        {
+            batch.push_back(std::move(value));
+        }
+
+        if (!batch.empty())
+        {
+            write_batch(batch);
+            batch.clear();
+
+            continue;
+        }
+
+        if (_is_stopping.load() && !has_pending_records())
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(_wakeup_mutex);
+        _is_writer_waiting.store(true);
+
+        if (!_is_stopping.load() && !has_pending_records())
+        {
+            _wakeup.wait_for(lock, std::chrono::milliseconds(50));
+        }
+
+        _is_writer_waiting.store(false);
+    }
+}
+
+void client_logger::async_writer::write_batch(
+    std::vector<record> const &batch)
+{
+    std::vector<std::string> buffers(_streams.size());
+
+    for (auto const &value: batch)
+    {
+        for (size_t stream_index: _routes[value.severity_index])
+        {
+            buffers[stream_index].append(value.text).push_back('\n');
+        }
+    }
+
+    for (size_t i = 0; i < _streams.size(); ++i)
+    {
+        if (buffers[i].empty())
+        {
+            continue;
+        }
+
+        try
+        {
+            std::lock_guard<std::mutex> lock(*_streams[i].target_mutex);
+            *_streams[i].target << buffers[i] << std::flush;
+        }
+        catch (...)
+        {
+
+        }
+    }
 }
 
 client_logger::client_logger(
-    client_logger &&other) noexcept
+    std::map<std::string, std::set<logger::severity>> const &file_streams,
+    std::set<logger::severity> const &console_stream_severities,
+    size_t async_queue_capacity,
+    client_logger_builder::overflow_policy async_overflow_policy,
+    logger::datetime_precision datetime_precision):
+    _datetime_precision(datetime_precision)
+{
+    for (auto const &file_stream: file_streams)
+    {
+        auto const target = obtain_file_stream(file_stream.first);
+
+        _streams.push_back({ file_stream.first, std::shared_ptr<std::ostream>(target, &target->target), std::shared_ptr<std::mutex>(target, &target->mutex),
+            obtain_severities_mask(file_stream.second) });
+    }
+
+    if (!console_stream_severities.empty())
+    {
+        _streams.push_back({ std::string(), std::shared_ptr<std::ostream>(&std::cout, [](std::ostream *) { }), obtain_console_mutex(),
+            obtain_severities_mask(console_stream_severities) });
+    }
+
+    build_routes();
+
+    if (async_queue_capacity != 0)
+    {
+        _async_writer = std::make_shared<async_writer>(_streams, _routes, async_queue_capacity, async_overflow_policy);
+    }
+}
+
+client_logger::client_logger(
+    client_logger const &other) = default;
+
+client_logger &client_logger::operator=(
+    client_logger const &other) = default;
+
+client_logger::client_logger(
+    client_logger &&other) noexcept:
+    _streams(std::move(other._streams)),
+    _routes(std::move(other._routes)),
+    _minimum_enabled_severity_index(other._minimum_enabled_severity_index),
+    _datetime_precision(other._datetime_precision),
+    _async_writer(std::move(other._async_writer))
 {
-    throw not_implemented("client_logger::client_logger(client_logger &&other) noexcept", "your code should be here...");
+    other._minimum_enabled_severity_index = severities_count;
 }
 
 client_logger &client_logger::operator=(
     client_logger &&other) noexcept
 {
-    throw not_implemented("client_logger &client_logger::operator=(client_logger &&other) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        _streams = std::move(other._streams);
+        _routes = std::move(other._routes);
+        _minimum_enabled_severity_index = other._minimum_enabled_severity_index;
+        _datetime_precision = other._datetime_precision;
+        _async_writer = std::move(other._async_writer);
+        other._minimum_enabled_severity_index = severities_count;
+    }
+
+    return *this;
 }
 
 client_logger::~client_logger() noexcept
 {
-    throw not_implemented("client_logger::~client_logger() noexcept", "your code should be here...");
+    for (auto const &target_stream: _streams)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock(*target_stream.target_mutex);
+            target_stream.target->flush();
+        }
+        catch (...)
+        {
+
+        }
+    }
 }
 
 logger const *client_logger::log(
     const std::string &text,
     logger::severity severity) const noexcept
 {
-    throw not_implemented("logger const *client_logger::log(const std::string &text, logger::severity severity) const noexcept", "your code should be here...");
+    if (!is_severity_enabled(severity))
+    {
+        return this;
+    }
+
+    try
+    {
+        std::string formatted_text = "[" + current_datetime_to_string(_datetime_precision) + "][" + severity_to_string(severity) + "] " + text;
+
+        if (_async_writer != nullptr)
+        {
+            _async_writer->push(std::move(formatted_text), obtain_severity_index(severity));
+
+            return this;
+        }
+
+        for (size_t stream_index: _routes[obtain_severity_index(severity)])
+        {
+            stream const &target_stream = _streams[stream_index];
+            std::lock_guard<std::mutex> lock(*target_stream.target_mutex);
+            *target_stream.target << formatted_text << '\n';
+
+            // lower severities stay in the stream buffer until it fills up, a flushing record arrives or the logger is destroyed
+            if (severity >= flush_severity)
+            {
+                target_stream.target->flush();
+            }
+        }
+    }
+    catch (...)
+    {
+
+    }
+
+    return this;
+}
+
+bool client_logger::is_severity_enabled(
+    logger::severity severity) const noexcept
+{
+    size_t const severity_index = obtain_severity_index(severity);
+
+    return severity_index >= _minimum_enabled_severity_index && !_routes[severity_index].empty();
+}
+
+std::shared_ptr<client_logger::file_stream> client_logger::obtain_file_stream(
+    std::string const &file_path)
+{
+    file_streams_registry &registry = obtain_file_streams_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto const registered = registry.streams.find(file_path);
+
+    if (registered != registry.streams.end())
+    {
+        auto target = registered->second.lock();
+
+        if (target != nullptr)
+        {
+            return target;
+        }
+    }
+
+    std::unique_ptr<file_stream> opened(new file_stream);
+    opened->buffer.reset(new char[file_stream::buffer_size]);
+    opened->target.rdbuf()->pubsetbuf(opened->buffer.get(), file_stream::buffer_size);
+    opened->target.open(file_path, std::ios::app);
+
+    if (!opened->target.is_open())
+    {
+        throw std::runtime_error("can't open log file " + file_path);
+    }
+
+    std::shared_ptr<file_stream> target(opened.release(), [file_path](file_stream *released)
+    {
+        {
+            file_streams_registry &registry = obtain_file_streams_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto const registered = registry.streams.find(file_path);
+
+            if (registered != registry.streams.end() && registered->second.expired())
+            {
+                registry.streams.erase(registered);
+            }
+        }
+
+        delete released;
+    });
+
+    registry.streams[file_path] = target;
+
+    return target;
+}
+
+client_logger::file_streams_registry &client_logger::obtain_file_streams_registry()
+{
+    static auto *registry = new file_streams_registry;
+
+    return *registry;
+}
+
+std::shared_ptr<std::mutex> const &client_logger::obtain_console_mutex()
+{
+    static std::shared_ptr<std::mutex> const console_mutex = std::make_shared<std::mutex>();
+
+    return console_mutex;
+}
+
+void client_logger::build_routes()
+{
+    _minimum_enabled_severity_index = severities_count;
+
+    for (size_t severity_index = 0; severity_index < severities_count; ++severity_index)
+    {
+        _routes[severity_index].clear();
+
+        for (size_t stream_index = 0; stream_index < _streams.size(); ++stream_index)
+        {
+            if ((_streams[stream_index].severities_mask & obtain_severity_bit(static_cast<logger::severity>(severity_index))) != 0)
+            {
+                _routes[severity_index].push_back(stream_index);
+            }
+        }
+
+        _routes[severity_index].shrink_to_fit();
+
+        if (_minimum_enabled_severity_index == severities_count && !_routes[severity_index].empty())
+        {
+            _minimum_enabled_severity_index = severity_index;
+        }
+    }
+}
+
+inline size_t client_logger::obtain_severity_index(
+    logger::severity severity) noexcept
+{
+    return static_cast<size_t>(severity);
+}
+
+inline unsigned char client_logger::obtain_severities_mask(
+    std::set<logger::severity> const &severities) noexcept
+{
+    unsigned char mask = 0;
+
+    for (auto severity: severities)
+    {
+        mask |= obtain_severity_bit(severity);
+    }
+
+    return mask;
+}
+
+inline unsigned char client_logger::obtain_severity_bit(
+    logger::severity severity) noexcept
+{
+    return static_cast<unsigned char>(1 << static_cast<int>(severity));
 }
\ No newline at end of file
@@ -1,67 +1,184 @@
-#include <not_implemented.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
 
 #include "../include/client_logger_builder.h"
+#include "../include/client_logger.h"
 
-client_logger_builder::client_logger_builder()
+client_logger_builder::client_logger_builder():
+    _async_queue_capacity(0),
+    _async_overflow_policy(overflow_policy::block),
+    _datetime_precision(logger::datetime_precision::seconds)
 {
-    throw not_implemented("client_logger_builder::client_logger_builder()", "your code should be here...");
+
 }
 
 client_logger_builder::client_logger_builder(
-    client_logger_builder const &other)
-{
-    throw not_implemented("client_logger_builder::client_logger_builder(client_logger_builder const &other)", "your code should be here...");
-}
+    client_logger_builder const &other) = default;
 
 client_logger_builder &client_logger_builder::operator=(
-    client_logger_builder const &other)
-{
-    throw not_implemented("client_logger_builder &client_logger_builder::operator=(client_logger_builder const &other)", "your code should be here...");
-}
+    client_logger_builder const &other) = default;
 
 client_logger_builder::client_logger_builder(
-    client_logger_builder &&other) noexcept
-{
-    throw not_implemented("client_logger_builder::client_logger_builder(client_logger_builder &&other) noexcept", "your code should be here...");
-}
+    client_logger_builder &&other) noexcept = default;
 
 client_logger_builder &client_logger_builder::operator=(
-    client_logger_builder &&other) noexcept
-{
-    throw not_implemented("client_logger_builder &client_logger_builder::operator=(client_logger_builder &&other) noexcept", "your code should be here...");
-}
+    client_logger_builder &&other) noexcept = default;
 
-client_logger_builder::~client_logger_builder() noexcept
-{
-    throw not_implemented("client_logger_builder::~client_logger_builder() noexcept", "your code should be here...");
-}
+client_logger_builder::~client_logger_builder() noexcept = default;
 
 logger_builder *client_logger_builder::add_file_stream(
     std::string const &stream_file_path,
     logger::severity severity)
 {
-    throw not_implemented("logger_builder *client_logger_builder::add_file_stream(std::string const &stream_file_path, logger::severity severity)", "your code should be here...");
+    _file_streams[stream_file_path].insert(severity);
+
+    return this;
 }
 
 logger_builder *client_logger_builder::add_console_stream(
     logger::severity severity)
 {
-    throw not_implemented("logger_builder *client_logger_builder::add_console_stream(logger::severity severity)", "your code should be here...");
+    _console_stream_severities.insert(severity);
+
+    return this;
 }
 
 logger_builder* client_logger_builder::transform_with_configuration(
     std::string const &configuration_file_path,
     std::string const &configuration_path)
 {
-    throw not_implemented("logger_builder* client_logger_builder::transform_with_configuration(std::string const &configuration_file_path, std::string const &configuration_path)", "your code should be here...");
+    std::ifstream configuration_file(configuration_file_path);
+
+    if (!configuration_file.is_open())
+    {
+        throw std::runtime_error("can't open logger configuration file " + configuration_file_path);
+    }
+
+    nlohmann::json configuration = nlohmann::json::parse(configuration_file);
+
+    std::istringstream path_stream(configuration_path);
+    for (std::string key; std::getline(path_stream, key, '/');)
+    {
+        if (!key.empty())
+        {
+            configuration = configuration.at(key);
+        }
+    }
+
+    for (auto const &stream: configuration.at("streams"))
+    {
+        std::string const type = stream.at("type").get<std::string>();
+
+        for (auto const &severity_string: stream.at("severities"))
+        {
+            logger::severity const severity = string_to_severity(severity_string.get<std::string>());
+
+            if (type == "file")
+            {
+                add_file_stream(stream.at("path").get<std::string>(), severity);
+            }
+            else if (type == "console")
+            {
+                add_console_stream(severity);
+            }
+            else
+            {
+                throw std::out_of_range("invalid logger stream type " + type);
+            }
+        }
+    }
+
+    auto const async_configuration = configuration.find("async");
+
+    if (async_configuration != configuration.end())
+    {
+        std::string const policy_string = async_configuration->value("overflow_policy", std::string("block"));
+        overflow_policy policy;
+
+        if (policy_string == "block")
+        {
+            policy = overflow_policy::block;
+        }
+        else if (policy_string == "drop_oldest")
+        {
+            policy = overflow_policy::drop_oldest;
+        }
+        else if (policy_string == "drop_newest")
+        {
+            policy = overflow_policy::drop_newest;
+        }
+        else
+        {
+            throw std::out_of_range("invalid logger overflow policy " + policy_string);
+        }
+
+        set_async_mode(async_configuration->at("queue_capacity").get<size_t>(), policy);
+    }
+
+    auto const datetime_precision_configuration = configuration.find("datetime_precision");
+
+    if (datetime_precision_configuration != configuration.end())
+    {
+        std::string const precision_string = datetime_precision_configuration->get<std::string>();
+
+        if (precision_string == "seconds")
+        {
+            set_datetime_precision(logger::datetime_precision::seconds);
+        }
+        else if (precision_string == "milliseconds")
+        {
+            set_datetime_precision(logger::datetime_precision::milliseconds);
+        }
+        else if (precision_string == "microseconds")
+        {
+            set_datetime_precision(logger::datetime_precision::microseconds);
+        }
+        else
+        {
+            throw std::out_of_range("invalid logger datetime precision " + precision_string);
+        }
+    }
+
+    return this;
 }
 
 logger_builder *client_logger_builder::clear()
 {
-    throw not_implemented("logger_builder *client_logger_builder::clear()", "your code should be here...");
+    _file_streams.clear();
+    _console_stream_severities.clear();
+    _async_queue_capacity = 0;
+    _async_overflow_policy = overflow_policy::block;
+    _datetime_precision = logger::datetime_precision::seconds;
+
+    return this;
+}
+
+client_logger_builder *client_logger_builder::set_async_mode(
+    size_t queue_capacity,
+    overflow_policy policy)
+{
+    if (queue_capacity == 0)
+    {
+        throw std::logic_error("async logger queue capacity must be positive");
+    }
+
+    _async_queue_capacity = queue_capacity;
+    _async_overflow_policy = policy;
+
+    return this;
+}
+
+client_logger_builder *client_logger_builder::set_datetime_precision(
+    logger::datetime_precision precision)
+{
+    _datetime_precision = precision;
+
+    return this;
 }
 
 logger *client_logger_builder::build() const
 {
-    throw not_implemented("logger *client_logger_builder::build() const", "your code should be here...");
+    return new client_logger(_file_streams, _console_stream_severities, _async_queue_capacity, _async_overflow_policy, _datetime_precision);
 }
\ No newline at end of file
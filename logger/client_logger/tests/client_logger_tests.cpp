@@ -1,6 +1,470 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <dirent.h>
+#include <thread>
+#include <client_logger.h>
+#include <client_logger_builder.h>
+#include <logger_guardant.h>
 
+namespace
+{
+
+    size_t count_open_descriptors()
+    {
+        DIR *descriptors = opendir("/proc/self/fd");
+        size_t count = 0;
+
+        while (readdir(descriptors) != nullptr)
+        {
+            ++count;
+        }
+
+        closedir(descriptors);
+
+        return count;
+    }
+
+    std::string read_file(
+        std::string const &path)
+    {
+        std::ifstream stream(path);
+
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    struct streamed_value final
+    {
+
+        size_t *streams_count;
+
+    };
+
+    std::ostream &operator<<(
+        std::ostream &stream,
+        streamed_value const &value)
+    {
+        ++*value.streams_count;
+
+        return stream << "streamed";
+    }
+
+    class guarded_subject final:
+        private logger_guardant
+    {
+
+    private:
+
+        logger *_logger;
+
+    public:
+
+        explicit guarded_subject(
+            logger *logger):
+            _logger(logger)
+        {
+
+        }
+
+    public:
+
+        size_t log_lazily(
+            logger::severity severity)
+        {
+            size_t messages_built_count = 0;
+
+            log_with_guard([&messages_built_count]()
+            {
+                ++messages_built_count;
+
+                return std::string("lazy message");
+            }, severity);
+
+            return messages_built_count;
+        }
+
+    private:
+
+        logger *get_logger() const override
+        {
+            return _logger;
+        }
+
+    };
+
+}
+
+TEST(clientLoggerPositiveTests, test1)
+{
+    std::string const log_file_path = "client_logger_test1.log";
+    std::remove(log_file_path.c_str());
+
+    logger_builder *builder = new client_logger_builder();
+    logger *subject = builder
+        ->add_file_stream(log_file_path, logger::severity::debug)
+        ->add_file_stream(log_file_path, logger::severity::error)
+        ->build();
+    delete builder;
+
+    ASSERT_TRUE(subject->is_severity_enabled(logger::severity::debug));
+    ASSERT_TRUE(subject->is_severity_enabled(logger::severity::error));
+    ASSERT_FALSE(subject->is_severity_enabled(logger::severity::information));
+
+    subject->debug("first message");
+    subject->information("second message");
+    subject->error("third message");
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_NE(contents.find("[DEBUG] first message"), std::string::npos);
+    ASSERT_EQ(contents.find("second message"), std::string::npos);
+    ASSERT_NE(contents.find("[ERROR] third message"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test2)
+{
+    logger_builder *builder = new client_logger_builder();
+    logger *subject = builder
+        ->add_console_stream(logger::severity::information)
+        ->build();
+    delete builder;
+
+    guarded_subject guarded(subject);
+
+    ASSERT_EQ(guarded.log_lazily(logger::severity::trace), 0);
+    ASSERT_EQ(guarded.log_lazily(logger::severity::debug), 0);
+    ASSERT_EQ(guarded.log_lazily(logger::severity::information), 1);
+    ASSERT_EQ(guarded_subject(nullptr).log_lazily(logger::severity::critical), 0);
+
+    delete subject;
+}
+
+TEST(clientLoggerPositiveTests, test3)
+{
+    std::string const configuration_file_path = "client_logger_test3.json";
+    std::string const log_file_path = "client_logger_test3.log";
+    std::remove(log_file_path.c_str());
+
+    std::ofstream(configuration_file_path) << R"({ "loggers": { "allocator": { "streams": [
+        { "type": "file", "path": ")" << log_file_path << R"(", "severities": [ "warning", "critical" ] } ] } } })";
+
+    logger_builder *builder = new client_logger_builder();
+    logger *subject = builder
+        ->transform_with_configuration(configuration_file_path, "loggers/allocator")
+        ->build();
+    delete builder;
+
+    ASSERT_TRUE(subject->is_severity_enabled(logger::severity::warning));
+    ASSERT_FALSE(subject->is_severity_enabled(logger::severity::debug));
+
+    subject->warning("configured message");
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+    std::remove(configuration_file_path.c_str());
+
+    ASSERT_NE(contents.find("[WARNING] configured message"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test4)
+{
+    std::string const log_file_path = "client_logger_test4.log";
+    std::remove(log_file_path.c_str());
+
+    client_logger_builder builder;
+    builder.set_async_mode(16);
+    logger *subject = builder
+        .add_file_stream(log_file_path, logger::severity::debug)
+        ->build();
+
+    int const threads_count = 4;
+    int const messages_count = 1000;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < threads_count; ++i)
+    {
+        threads.emplace_back([subject, i]()
+        {
+            for (int j = 0; j < messages_count; ++j)
+            {
+                subject->debug("message " + std::to_string(i) + ":" + std::to_string(j));
+            }
+        });
+    }
+
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_EQ(std::count(contents.begin(), contents.end(), '\n'), threads_count * messages_count);
+
+    for (int i = 0; i < threads_count; ++i)
+    {
+        ASSERT_NE(contents.find("] message " + std::to_string(i) + ":" + std::to_string(messages_count - 1) + "\n"), std::string::npos);
+    }
+}
+
+TEST(clientLoggerPositiveTests, test5)
+{
+    std::string const log_file_path = "client_logger_test5.log";
+    int const messages_count = 10000;
+
+    for (auto policy: { client_logger_builder::overflow_policy::drop_oldest, client_logger_builder::overflow_policy::drop_newest })
+    {
+        std::remove(log_file_path.c_str());
+
+        client_logger_builder builder;
+        builder.set_async_mode(4, policy);
+        logger *subject = builder
+            .add_file_stream(log_file_path, logger::severity::information)
+            ->build();
+
+        for (int i = 0; i < messages_count; ++i)
+        {
+            subject->information("message " + std::to_string(i));
+        }
+
+        delete subject;
+
+        std::string const contents = read_file(log_file_path);
+        std::remove(log_file_path.c_str());
+
+        ASSERT_LE(std::count(contents.begin(), contents.end(), '\n'), messages_count);
+        ASSERT_NE(contents.find(policy == client_logger_builder::overflow_policy::drop_oldest
+            ? "] message " + std::to_string(messages_count - 1) + "\n"
+            : "] message 0\n"), std::string::npos);
+    }
+}
+
+TEST(clientLoggerPositiveTests, test6)
+{
+    std::string const configuration_file_path = "client_logger_test6.json";
+    std::string const log_file_path = "client_logger_test6.log";
+    std::remove(log_file_path.c_str());
+
+    std::ofstream(configuration_file_path) << R"({ "async": { "queue_capacity": 64, "overflow_policy": "drop_newest" }, "streams": [
+        { "type": "file", "path": ")" << log_file_path << R"(", "severities": [ "error" ] } ] })";
+
+    logger_builder *builder = new client_logger_builder();
+    logger *subject = builder
+        ->transform_with_configuration(configuration_file_path, "")
+        ->build();
+    delete builder;
+
+    subject->error("asynchronous message");
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+    std::remove(configuration_file_path.c_str());
+
+    ASSERT_NE(contents.find("[ERROR] asynchronous message"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test7)
+{
+    std::string const log_file_path = "client_logger_test7.log";
+    std::remove(log_file_path.c_str());
+
+    size_t const initial_descriptors_count = count_open_descriptors();
+    std::vector<logger *> subjects;
+
+    for (int i = 0; i < 50; ++i)
+    {
+        client_logger_builder builder;
+        subjects.push_back(builder
+            .add_file_stream(log_file_path, logger::severity::information)
+            ->build());
+    }
+
+    ASSERT_EQ(count_open_descriptors(), initial_descriptors_count + 1);
+
+    logger *copied_subject = new client_logger(*dynamic_cast<client_logger *>(subjects.front()));
+
+    for (size_t i = 0; i < subjects.size(); ++i)
+    {
+        subjects[i]->information("component " + std::to_string(i));
+        delete subjects[i];
+    }
+
+    ASSERT_EQ(count_open_descriptors(), initial_descriptors_count + 1);
+
+    copied_subject->information("copied component");
+    delete copied_subject;
+
+    ASSERT_EQ(count_open_descriptors(), initial_descriptors_count);
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_NE(contents.find("] component 0\n"), std::string::npos);
+    ASSERT_NE(contents.find("] component 49\n"), std::string::npos);
+    ASSERT_NE(contents.find("] copied component\n"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test8)
+{
+    std::string const first_log_file_path = "client_logger_test8_first.log";
+    std::string const second_log_file_path = "client_logger_test8_second.log";
+    std::remove(first_log_file_path.c_str());
+    std::remove(second_log_file_path.c_str());
+
+    client_logger_builder builder;
+    logger *subject = builder
+        .add_file_stream(first_log_file_path, logger::severity::information)
+        ->add_file_stream(first_log_file_path, logger::severity::critical)
+        ->add_file_stream(second_log_file_path, logger::severity::critical)
+        ->build();
+    logger *moved_subject = new client_logger(std::move(*dynamic_cast<client_logger *>(subject)));
+
+    ASSERT_FALSE(subject->is_severity_enabled(logger::severity::critical));
+    ASSERT_FALSE(moved_subject->is_severity_enabled(logger::severity::debug));
+    ASSERT_TRUE(moved_subject->is_severity_enabled(logger::severity::information));
+    ASSERT_FALSE(moved_subject->is_severity_enabled(logger::severity::error));
+
+    moved_subject->information("routed to first");
+    moved_subject->error("routed nowhere");
+    moved_subject->critical("routed to both");
+    delete moved_subject;
+    delete subject;
+
+    std::string const first_contents = read_file(first_log_file_path);
+    std::string const second_contents = read_file(second_log_file_path);
+    std::remove(first_log_file_path.c_str());
+    std::remove(second_log_file_path.c_str());
+
+    ASSERT_NE(first_contents.find("routed to first"), std::string::npos);
+    ASSERT_NE(first_contents.find("routed to both"), std::string::npos);
+    ASSERT_EQ(first_contents.find("routed nowhere"), std::string::npos);
+    ASSERT_EQ(second_contents.find("routed to first"), std::string::npos);
+    ASSERT_NE(second_contents.find("routed to both"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test9)
+{
+    std::string const log_file_path = "client_logger_test9.log";
+    std::remove(log_file_path.c_str());
+
+    client_logger_builder builder;
+    builder.set_datetime_precision(logger::datetime_precision::milliseconds);
+    logger *subject = builder
+        .add_file_stream(log_file_path, logger::severity::information)
+        ->build();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        subject->information("precise message");
+    }
+
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_EQ(contents.find(']'), std::string("[dd.mm.yyyy hh:mm:ss.mmm").size());
+    ASSERT_EQ(contents.substr(20, 1), ".");
+    ASSERT_EQ(std::count(contents.begin(), contents.end(), '\n'), 3);
+}
+
+TEST(clientLoggerPositiveTests, test10)
+{
+    std::string const log_file_path = "client_logger_test10.log";
+    std::remove(log_file_path.c_str());
+
+    client_logger_builder builder;
+    logger *subject = builder
+        .add_file_stream(log_file_path, logger::severity::information)
+        ->build();
+
+    size_t streams_count = 0;
+    std::string const name = "allocator";
+
+    subject->debug_format("filtered {}", streamed_value { &streams_count });
+    subject->information_format("{} allocated {} blocks of {} bytes, ratio {}, {} {} {{}}",
+        name, 3, static_cast<size_t>(4096), 0.5, true, streamed_value { &streams_count });
+    subject->information_format("{}:{} missing {}", 'x', -7);
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_EQ(streams_count, 1);
+    ASSERT_EQ(contents.find("filtered"), std::string::npos);
+    ASSERT_NE(contents.find("] allocator allocated 3 blocks of 4096 bytes, ratio 0.5, true streamed {}\n"), std::string::npos);
+    ASSERT_NE(contents.find("] x:-7 missing {}\n"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test11)
+{
+    std::string const log_file_path = "client_logger_test11.log";
+    int const messages_count = 1000;
+    std::remove(log_file_path.c_str());
+
+    client_logger_builder builder;
+    builder.set_async_mode(1);
+    logger *subject = builder
+        .add_file_stream(log_file_path, logger::severity::information)
+        ->build();
+
+    for (int i = 0; i < messages_count; ++i)
+    {
+        subject->information("message " + std::to_string(i));
+    }
+
+    delete subject;
+
+    std::string const contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_EQ(std::count(contents.begin(), contents.end(), '\n'), messages_count);
+    ASSERT_NE(contents.find("] message " + std::to_string(messages_count - 1) + "\n"), std::string::npos);
+}
+
+TEST(clientLoggerPositiveTests, test12)
+{
+    std::string const log_file_path = "client_logger_test12.log";
+    std::remove(log_file_path.c_str());
+
+    client_logger_builder builder;
+    logger *subject = builder
+        .add_file_stream(log_file_path, logger::severity::information)
+        ->add_file_stream(log_file_path, logger::severity::warning)
+        ->build();
+
+    subject->information("buffered message");
+    subject->warning("flushing message");
+
+    std::string contents = read_file(log_file_path);
+
+    ASSERT_NE(contents.find("[INFORMATION] buffered message\n"), std::string::npos);
+    ASSERT_NE(contents.find("[WARNING] flushing message\n"), std::string::npos);
+
+    subject->information("trailing message");
+    delete subject;
+
+    contents = read_file(log_file_path);
+    std::remove(log_file_path.c_str());
+
+    ASSERT_NE(contents.find("[INFORMATION] trailing message\n"), std::string::npos);
+}
+
+TEST(clientLoggerNegativeTests, test1)
+{
+    client_logger_builder builder;
 
+    ASSERT_THROW(builder.set_async_mode(0), std::logic_error);
+}
 
 int main(
     int argc,
@@ -2,6 +2,9 @@
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_H
 
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
 
 class logger
 {
@@ -18,6 +21,13 @@ public:
         critical
     };
 
+    enum class datetime_precision
+    {
+        seconds,
+        milliseconds,
+        microseconds
+    };
+
 public:
 
     virtual ~logger() noexcept = default;
@@ -28,6 +38,9 @@ public:
         std::string const &message,
         logger::severity severity) const noexcept = 0;
 
+    virtual bool is_severity_enabled(
+        logger::severity severity) const noexcept;
+
 public:
 
     logger const *trace(
@@ -48,13 +61,278 @@ public:
     logger const *critical(
         std::string const &message) const noexcept;
 
+public:
+
+    template<
+        typename ...argument_types>
+    logger const *log_format(
+        logger::severity severity,
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+    template<
+        typename ...argument_types>
+    logger const *trace_format(
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+    template<
+        typename ...argument_types>
+    logger const *debug_format(
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+    template<
+        typename ...argument_types>
+    logger const *information_format(
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+    template<
+        typename ...argument_types>
+    logger const *warning_format(
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+    template<
+        typename ...argument_types>
+    logger const *error_format(
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+    template<
+        typename ...argument_types>
+    logger const *critical_format(
+        char const *format,
+        argument_types const &... arguments) const noexcept;
+
+private:
+
+    static std::string &obtain_format_buffer() noexcept;
+
+    static char const *append_until_placeholder(
+        std::string &buffer,
+        char const *format);
+
+    static void format_to(
+        std::string &buffer,
+        char const *format);
+
+    template<
+        typename argument_type,
+        typename ...argument_types>
+    static void format_to(
+        std::string &buffer,
+        char const *format,
+        argument_type const &argument,
+        argument_types const &... arguments);
+
+    static void append_argument(
+        std::string &buffer,
+        std::string const &argument);
+
+    static void append_argument(
+        std::string &buffer,
+        char const *argument);
+
+    static void append_argument(
+        std::string &buffer,
+        char argument);
+
+    static void append_argument(
+        std::string &buffer,
+        bool argument);
+
+    static void append_signed_argument(
+        std::string &buffer,
+        long long argument);
+
+    static void append_unsigned_argument(
+        std::string &buffer,
+        unsigned long long argument);
+
+    static void append_floating_argument(
+        std::string &buffer,
+        double argument);
+
+    template<
+        typename argument_type>
+    static typename std::enable_if<std::is_enum<argument_type>::value
+        || (std::is_integral<argument_type>::value && std::is_signed<argument_type>::value && !std::is_same<argument_type, char>::value)>::type append_argument(
+        std::string &buffer,
+        argument_type const &argument);
+
+    template<
+        typename argument_type>
+    static typename std::enable_if<std::is_integral<argument_type>::value && std::is_unsigned<argument_type>::value
+        && !std::is_same<argument_type, bool>::value && !std::is_same<argument_type, char>::value>::type append_argument(
+        std::string &buffer,
+        argument_type const &argument);
+
+    template<
+        typename argument_type>
+    static typename std::enable_if<std::is_floating_point<argument_type>::value>::type append_argument(
+        std::string &buffer,
+        argument_type const &argument);
+
+    template<
+        typename argument_type>
+    static typename std::enable_if<!std::is_arithmetic<argument_type>::value && !std::is_enum<argument_type>::value
+        && !std::is_convertible<argument_type const &, std::string const &>::value
+        && !std::is_convertible<argument_type const &, char const *>::value>::type append_argument(
+        std::string &buffer,
+        argument_type const &argument);
+
 protected:
 
     static std::string severity_to_string(
         logger::severity severity);
 
-    static std::string current_datetime_to_string() noexcept;
+    static std::string current_datetime_to_string(
+        logger::datetime_precision precision = logger::datetime_precision::seconds) noexcept;
 
 };
 
+template<
+    typename ...argument_types>
+logger const *logger::log_format(
+    logger::severity severity,
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    if (!is_severity_enabled(severity))
+    {
+        return this;
+    }
+
+    try
+    {
+        std::string &buffer = obtain_format_buffer();
+        buffer.clear();
+        format_to(buffer, format, arguments...);
+
+        return log(buffer, severity);
+    }
+    catch (...)
+    {
+        return this;
+    }
+}
+
+template<
+    typename ...argument_types>
+logger const *logger::trace_format(
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    return log_format(logger::severity::trace, format, arguments...);
+}
+
+template<
+    typename ...argument_types>
+logger const *logger::debug_format(
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    return log_format(logger::severity::debug, format, arguments...);
+}
+
+template<
+    typename ...argument_types>
+logger const *logger::information_format(
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    return log_format(logger::severity::information, format, arguments...);
+}
+
+template<
+    typename ...argument_types>
+logger const *logger::warning_format(
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    return log_format(logger::severity::warning, format, arguments...);
+}
+
+template<
+    typename ...argument_types>
+logger const *logger::error_format(
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    return log_format(logger::severity::error, format, arguments...);
+}
+
+template<
+    typename ...argument_types>
+logger const *logger::critical_format(
+    char const *format,
+    argument_types const &... arguments) const noexcept
+{
+    return log_format(logger::severity::critical, format, arguments...);
+}
+
+template<
+    typename argument_type,
+    typename ...argument_types>
+void logger::format_to(
+    std::string &buffer,
+    char const *format,
+    argument_type const &argument,
+    argument_types const &... arguments)
+{
+    char const *format_rest = append_until_placeholder(buffer, format);
+
+    if (format_rest == nullptr)
+    {
+        return;
+    }
+
+    append_argument(buffer, argument);
+    format_to(buffer, format_rest, arguments...);
+}
+
+template<
+    typename argument_type>
+typename std::enable_if<std::is_enum<argument_type>::value
+    || (std::is_integral<argument_type>::value && std::is_signed<argument_type>::value && !std::is_same<argument_type, char>::value)>::type logger::append_argument(
+    std::string &buffer,
+    argument_type const &argument)
+{
+    append_signed_argument(buffer, static_cast<long long>(argument));
+}
+
+template<
+    typename argument_type>
+typename std::enable_if<std::is_integral<argument_type>::value && std::is_unsigned<argument_type>::value
+    && !std::is_same<argument_type, bool>::value && !std::is_same<argument_type, char>::value>::type logger::append_argument(
+    std::string &buffer,
+    argument_type const &argument)
+{
+    append_unsigned_argument(buffer, static_cast<unsigned long long>(argument));
+}
+
+template<
+    typename argument_type>
+typename std::enable_if<std::is_floating_point<argument_type>::value>::type logger::append_argument(
+    std::string &buffer,
+    argument_type const &argument)
+{
+    append_floating_argument(buffer, static_cast<double>(argument));
+}
+
+template<
+    typename argument_type>
+typename std::enable_if<!std::is_arithmetic<argument_type>::value && !std::is_enum<argument_type>::value
+    && !std::is_convertible<argument_type const &, std::string const &>::value
+    && !std::is_convertible<argument_type const &, char const *>::value>::type logger::append_argument(
+    std::string &buffer,
+    argument_type const &argument)
+{
+    std::ostringstream argument_stream;
+    argument_stream << argument;
+    buffer.append(argument_stream.str());
+}
+
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_H
\ No newline at end of file
@@ -1,11 +1,21 @@
 #ifndef MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_GUARDANT_H
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_GUARDANT_H
 
+#include <string>
+#include <type_traits>
+#include <utility>
 #include "logger.h"
 
 class logger_guardant
 {
 
+private:
+
+    template<
+        typename message_factory>
+    using lazy_message_t = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<message_factory const &>()()), std::string>::value>::type;
+
 public:
 
     virtual ~logger_guardant() noexcept = default;
@@ -34,10 +44,128 @@ public:
     logger_guardant const *critical_with_guard(
         std::string const &message) const;
 
+public:
+
+    bool is_log_enabled_with_guard(
+        logger::severity severity) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *log_with_guard(
+        message_factory const &create_message,
+        logger::severity severity) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *trace_with_guard(
+        message_factory const &create_message) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *debug_with_guard(
+        message_factory const &create_message) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *information_with_guard(
+        message_factory const &create_message) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *warning_with_guard(
+        message_factory const &create_message) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *error_with_guard(
+        message_factory const &create_message) const;
+
+    template<
+        typename message_factory,
+        typename = lazy_message_t<message_factory>>
+    logger_guardant const *critical_with_guard(
+        message_factory const &create_message) const;
+
 protected:
 
     inline virtual logger *get_logger() const = 0;
 
 };
 
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::log_with_guard(
+    message_factory const &create_message,
+    logger::severity severity) const
+{
+    logger *got_logger = get_logger();
+    if (got_logger != nullptr && got_logger->is_severity_enabled(severity))
+    {
+        got_logger->log(create_message(), severity);
+    }
+
+    return this;
+}
+
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::trace_with_guard(
+    message_factory const &create_message) const
+{
+    return log_with_guard(create_message, logger::severity::trace);
+}
+
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::debug_with_guard(
+    message_factory const &create_message) const
+{
+    return log_with_guard(create_message, logger::severity::debug);
+}
+
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::information_with_guard(
+    message_factory const &create_message) const
+{
+    return log_with_guard(create_message, logger::severity::information);
+}
+
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::warning_with_guard(
+    message_factory const &create_message) const
+{
+    return log_with_guard(create_message, logger::severity::warning);
+}
+
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::error_with_guard(
+    message_factory const &create_message) const
+{
+    return log_with_guard(create_message, logger::severity::error);
+}
+
+template<
+    typename message_factory,
+    typename>
+logger_guardant const *logger_guardant::critical_with_guard(
+    message_factory const &create_message) const
+{
+    return log_with_guard(create_message, logger::severity::critical);
+}
+
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_GUARDANT_H
\ No newline at end of file
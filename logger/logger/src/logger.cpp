@@ -1,5 +1,13 @@
 #include "../include/logger.h"
-#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+
+bool logger::is_severity_enabled(
+    logger::severity) const noexcept
+{
+    return true;
+}
 
 logger const *logger::trace(
     std::string const &message) const noexcept
@@ -59,12 +67,153 @@ std::string logger::severity_to_string(
     throw std::out_of_range("Invalid severity value");
 }
 
-std::string logger::current_datetime_to_string() noexcept
+std::string logger::current_datetime_to_string(
+    logger::datetime_precision precision) noexcept
+{
+    struct datetime_cache final
+    {
+
+        std::time_t second;
+
+        char formatted[32];
+
+        size_t formatted_length;
+
+    };
+
+    thread_local datetime_cache cache { -1, { }, 0 };
+
+    auto const now = std::chrono::system_clock::now();
+    std::time_t const second = std::chrono::system_clock::to_time_t(now);
+
+    if (second != cache.second)
+    {
+        std::tm local_time { };
+        localtime_r(&second, &local_time);
+
+        cache.formatted_length = std::strftime(cache.formatted, sizeof(cache.formatted), "%d.%m.%Y %H:%M:%S", &local_time);
+        cache.second = second;
+    }
+
+    std::string result(cache.formatted, cache.formatted_length);
+
+    if (precision == logger::datetime_precision::seconds)
+    {
+        return result;
+    }
+
+    auto const microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+        now - std::chrono::system_clock::from_time_t(second)).count();
+    char fraction[8];
+
+    if (precision == logger::datetime_precision::milliseconds)
+    {
+        std::snprintf(fraction, sizeof(fraction), ".%03d", static_cast<int>(microseconds / 1000));
+    }
+    else
+    {
+        std::snprintf(fraction, sizeof(fraction), ".%06d", static_cast<int>(microseconds));
+    }
+
+    return result.append(fraction);
+}
+
+std::string &logger::obtain_format_buffer() noexcept
+{
+    thread_local std::string buffer;
+
+    return buffer;
+}
+
+char const *logger::append_until_placeholder(
+    std::string &buffer,
+    char const *format)
+{
+    while (*format != '\0')
+    {
+        if (format[0] == '{' && format[1] == '}')
+        {
+            return format + 2;
+        }
+
+        if ((format[0] == '{' && format[1] == '{') || (format[0] == '}' && format[1] == '}'))
+        {
+            ++format;
+        }
+
+        buffer.push_back(*format++);
+    }
+
+    return nullptr;
+}
+
+void logger::format_to(
+    std::string &buffer,
+    char const *format)
 {
-    auto time = std::time(nullptr);
+    while (format != nullptr)
+    {
+        format = append_until_placeholder(buffer, format);
+
+        if (format != nullptr)
+        {
+            buffer.append("{}");
+        }
+    }
+}
 
-    std::ostringstream result_stream;
-    result_stream << std::put_time(std::localtime(&time), "%d.%m.%Y %H:%M:%S");
+void logger::append_argument(
+    std::string &buffer,
+    std::string const &argument)
+{
+    buffer.append(argument);
+}
 
-    return result_stream.str();
+void logger::append_argument(
+    std::string &buffer,
+    char const *argument)
+{
+    buffer.append(argument == nullptr
+        ? "(null)"
+        : argument);
+}
+
+void logger::append_argument(
+    std::string &buffer,
+    char argument)
+{
+    buffer.push_back(argument);
+}
+
+void logger::append_argument(
+    std::string &buffer,
+    bool argument)
+{
+    buffer.append(argument
+        ? "true"
+        : "false");
+}
+
+void logger::append_signed_argument(
+    std::string &buffer,
+    long long argument)
+{
+    char formatted[24];
+    buffer.append(formatted, std::snprintf(formatted, sizeof(formatted), "%lld", argument));
+}
+
+void logger::append_unsigned_argument(
+    std::string &buffer,
+    unsigned long long argument)
+{
+    char formatted[24];
+    buffer.append(formatted, std::snprintf(formatted, sizeof(formatted), "%llu", argument));
+}
+
+void logger::append_floating_argument(
+    std::string &buffer,
+    double argument)
+{
+    char formatted[32];
+    buffer.append(formatted, std::snprintf(formatted, sizeof(formatted), "%g", argument));
 }
\ No newline at end of file
@@ -5,7 +5,7 @@ logger_guardant const *logger_guardant::log_with_guard(
     logger::severity severity) const
 {
     logger *got_logger = get_logger();
-    if (got_logger != nullptr)
+    if (got_logger != nullptr && got_logger->is_severity_enabled(severity))
     {
         got_logger->log(message, severity);
     }
@@ -47,4 +47,12 @@ logger_guardant const *logger_guardant::critical_with_guard(
     std::string const &message) const
 {
     return log_with_guard(message, logger::severity::critical);
+}
+
+bool logger_guardant::is_log_enabled_with_guard(
+    logger::severity severity) const
+{
+    logger *got_logger = get_logger();
+
+    return got_logger != nullptr && got_logger->is_severity_enabled(severity);
 }
\ No newline at end of file